@@ -59,6 +59,11 @@ typedef struct directive_s
 
 int numtokens;
 
+// tokens handed back while a source is loaded, recycled by PC_CopyToken
+static token_t *freetokens;
+// number of sources currently loaded
+static int numsources;
+
 // list with global defines added to every source loaded
 define_t *globaldefines;
 
@@ -176,14 +181,21 @@ token_t *PC_CopyToken(token_t *token)
 {
 	token_t *t;
 
-	t = (token_t *) GetMemory(sizeof(token_t));
-	if (!t)
+	if (freetokens)
 	{
-		Com_Error(ERR_FATAL, "out of token space");
-		return NULL;
+		t          = freetokens;
+		freetokens = freetokens->next;
+	}
+	else
+	{
+		t = (token_t *) GetMemory(sizeof(token_t));
+		if (!t)
+		{
+			Com_Error(ERR_FATAL, "out of token space");
+			return NULL;
+		}
 	}
-	//freetokens = freetokens->next;
-	Com_Memcpy(t, token, sizeof(token_t));
+	PS_CopyToken(t, token);
 	t->next = NULL;
 	numtokens++;
 	return t;
@@ -192,13 +204,39 @@ token_t *PC_CopyToken(token_t *token)
 /**
  * @brief PC_FreeToken
  * @param[in] token
+ *
+ * @note While a source is loaded the token is kept for reuse, define expansion
+ * copies and frees tokens at a high rate
  */
 void PC_FreeToken(token_t *token)
 {
-	FreeMemory(token);
+	if (numsources > 0)
+	{
+		token->next = freetokens;
+		freetokens  = token;
+	}
+	else
+	{
+		FreeMemory(token);
+	}
 	numtokens--;
 }
 
+/**
+ * @brief Return the recycled tokens to the zone
+ */
+static void PC_FreeRecycledTokens(void)
+{
+	token_t *token;
+
+	while (freetokens)
+	{
+		token      = freetokens;
+		freetokens = freetokens->next;
+		FreeMemory(token);
+	}
+}
+
 /**
  * @brief PC_ReadSourceToken
  * @param[in,out] source
@@ -241,7 +279,7 @@ int PC_ReadSourceToken(source_t *source, token_t *token)
 		FreeScript(script);
 	}
 	// copy the already available token
-	Com_Memcpy(token, source->tokens, sizeof(token_t));
+	PS_CopyToken(token, source->tokens);
 	// free the read token
 	t              = source->tokens;
 	source->tokens = source->tokens->next;
@@ -3063,7 +3101,7 @@ int PC_ReadToken(source_t *source, token_t *token)
 			}
 		}
 		// copy token for unreading
-		Com_Memcpy(&source->token, token, sizeof(token_t));
+		PS_CopyToken(&source->token, token);
 		// found a token
 		return qtrue;
 	}
@@ -3388,6 +3426,7 @@ source_t *LoadSourceFile(const char *filename)
 	source->definehash = GetClearedMemory(DEFINEHASHSIZE * sizeof(define_t *));
 #endif //DEFINEHASHING
 	PC_AddGlobalDefinesToSource(source);
+	numsources++;
 	return source;
 }
 
@@ -3492,6 +3531,11 @@ void FreeSource(source_t *source)
 #endif //DEFINEHASHING
 	// free the source itself
 	FreeMemory(source);
+	// nothing left to recycle tokens for
+	if (--numsources == 0)
+	{
+		PC_FreeRecycledTokens();
+	}
 }
 
 #define MAX_SOURCEFILES     64
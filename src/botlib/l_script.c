@@ -927,11 +927,31 @@ int PS_ReadPrimitive(script_t *script, token_t *token)
 	}
 	token->string[len] = 0;
 	// copy the token into the script structure
-	Com_Memcpy(&script->token, token, sizeof(token_t));
+	PS_CopyToken(&script->token, token);
 	// primitive reading successfull
 	return 1;
 }
 
+/**
+ * @brief Copy a token
+ *
+ * Tokens are copied around for every read and unread, most of the MAX_TOKEN
+ * string buffer is unused so only copy up to the terminating zero.
+ *
+ * @param[out] dest
+ * @param[in] src
+ */
+void PS_CopyToken(token_t *dest, const token_t *src)
+{
+	if (dest == src)
+	{
+		return;
+	}
+
+	Com_Memcpy(dest->string, src->string, strlen(src->string) + 1);
+	Com_Memcpy(&dest->type, &src->type, sizeof(token_t) - offsetof(token_t, type));
+}
+
 /**
  * @brief Read a token from the script
  * @param[in,out] script
@@ -944,15 +964,22 @@ int PS_ReadToken(script_t *script, token_t *token)
 	if (script->tokenavailable)
 	{
 		script->tokenavailable = 0;
-		Com_Memcpy(token, &script->token, sizeof(token_t));
+		PS_CopyToken(token, &script->token);
 		return 1;
 	}
 	//save script pointer
 	script->lastscript_p = script->script_p;
 	// save line counter
 	script->lastline = script->line;
-	// clear the token stuff
-	Com_Memset(token, 0, sizeof(token_t));
+	// clear the token stuff, the string is always terminated by the PS_Read* functions
+	token->string[0] = '\0';
+	token->type      = 0;
+	token->subtype   = 0;
+#ifdef NUMBERVALUE
+	token->intvalue   = 0;
+	token->floatvalue = 0;
+#endif //NUMBERVALUE
+	token->next = NULL;
 	// start of the white space
 	script->whitespace_p = script->script_p;
 	token->whitespace_p  = script->script_p;
@@ -1017,7 +1044,7 @@ int PS_ReadToken(script_t *script, token_t *token)
 		return 0;
 	}
 	// copy the token into the script structure
-	Com_Memcpy(&script->token, token, sizeof(token_t));
+	PS_CopyToken(&script->token, token);
 	// successfully read a token
 	return 1;
 }
@@ -214,6 +214,8 @@ typedef struct script_s
 
 // read a token from the script
 int PS_ReadToken(script_t *script, token_t *token);
+// copy a token, only the used part of the string is copied
+void PS_CopyToken(token_t *dest, const token_t *src);
 // expect a certain token
 //int PS_ExpectTokenString(script_t *script, const char *string);
 // expect a certain token type
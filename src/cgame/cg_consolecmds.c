@@ -3625,6 +3625,9 @@ static consoleCommand_t commands[] =
 	{ "camera",                 CG_Camera_f                  },
 	{ "edithud",                CG_EditHud_f                 },
 	{ "editcomponent",          CG_EditComponent_f           },
+#ifdef ETLEGACY_DEBUG
+	{ "particlebench",          CG_ParticleBenchmark_f       },
+#endif
 
 	// TODO: Implement "alias" system and create those as customizable alias command
 	{ "cg_crosshairSize_f",     CG_CrosshairSizePos_f        },
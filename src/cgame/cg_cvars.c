@@ -756,6 +756,8 @@ void CG_RegisterCvars(void)
 	cvarsLoaded = qtrue;
 }
 
+static modifiedCvars_t cgCvarJournal;
+
 /**
  * @brief CG_UpdateCvars
  */
@@ -770,11 +772,13 @@ void CG_UpdateCvars(void)
 		return;
 	}
 
+	BG_FetchModifiedCvars(&cgCvarJournal);
+
 	for (i = 0, cv = cvarTable ; i < cvarTableSize ; i++, cv++)
 	{
 		if (cv->vmCvar)
 		{
-			trap_Cvar_Update(cv->vmCvar);
+			BG_UpdateCvar(&cgCvarJournal, cv->vmCvar);
 			if (cv->modificationCount != cv->vmCvar->modificationCount)
 			{
 				cv->modificationCount = cv->vmCvar->modificationCount;
@@ -851,8 +855,8 @@ void CG_UpdateCvars(void)
 		static int cg_customFont1_lastMod = 1;
 		static int cg_customFont2_lastMod = 1;
 
-		trap_Cvar_Update(&cg_customFont1);
-		trap_Cvar_Update(&cg_customFont2);
+		BG_UpdateCvar(&cgCvarJournal, &cg_customFont1);
+		BG_UpdateCvar(&cgCvarJournal, &cg_customFont2);
 
 		if (cg_customFont1.modificationCount != cg_customFont1_lastMod)
 		{
@@ -1518,6 +1518,9 @@ typedef struct
 	int backupStateTail;
 	int lastPredictedCommand;
 	int lastPhysicsTime;
+	int numPredictedCmds;                   ///< Pmoves run by the last CG_PredictPlayerState call
+	int numPlayedBackCmds;                  ///< commands restored from backupStates by the last CG_PredictPlayerState call
+	int numFullPredicts;                    ///< full re-predictions since cgame start (teleports and prediction errors)
 
 	qboolean skyboxEnabled;
 	vec3_t skyboxViewOrg;
@@ -3215,6 +3218,9 @@ void CG_ImpactMark(qhandle_t markShader,
 void CG_ClearParticles(void);
 void CG_InitParticles(void);
 void CG_AddParticles(void);
+#ifdef ETLEGACY_DEBUG
+void CG_ParticleBenchmark_f(void);
+#endif
 void CG_ParticleSnow(qhandle_t pshader, vec3_t origin, vec3_t origin2, int turb, float range, int snum);
 void CG_ParticleSmoke(qhandle_t pshader, centity_t *cent);
 void CG_ParticleSnowFlurry(qhandle_t pshader, centity_t *cent);
@@ -3701,12 +3707,14 @@ void trap_CommandComplete(const char *value);
 void trap_CmdBackup_Ext(void);
 void trap_MatchPaused(qboolean matchPaused);
 void trap_Cvar_SetDescription(const char *cvarName, const char *description);
+int trap_Cvar_GetModified(int *handles, int maxHandles);
 extern int dll_com_trapGetValue;
 extern int dll_trap_SysFlashWindow;
 extern int dll_trap_CommandComplete;
 extern int dll_trap_CmdBackup_Ext;
 extern int dll_trap_MatchPaused;
 extern int dll_trap_CvarSetDescription;
+extern int dll_trap_CvarGetModified;
 
 bg_playerclass_t *CG_PlayerClassForClientinfo(clientInfo_t *ci, centity_t *cent);
 
@@ -3842,6 +3850,9 @@ void CG_AttachBitsToTank(centity_t *tank, refEntity_t *mg42base, refEntity_t *mg
 polyBuffer_t *CG_PB_FindFreePolyBuffer(qhandle_t shader, int numVerts, int numIndicies);
 void CG_PB_ClearPolyBuffers(void);
 void CG_PB_RenderPolyBuffers(void);
+void CG_PB_AddPoly(qhandle_t shader, int numVerts, const polyVert_t *verts);
+void CG_PB_RenderPolyBatches(void);
+void CG_PB_ClearPolyBatches(void);
 
 // cg_limbopanel.c
 void CG_LimboPanel_KeyHandling(int key, qboolean down);
@@ -993,11 +993,11 @@ void CG_AddParticleToScene(cparticle_t *p, vec3_t org, float alpha)
 
 	if (p->type == P_WEATHER || p->type == P_WEATHER_TURBULENT || p->type == P_WEATHER_FLURRY)
 	{
-		trap_R_AddPolyToScene(p->pshader, 3, TRIverts);
+		CG_PB_AddPoly(p->pshader, 3, TRIverts);
 	}
 	else
 	{
-		trap_R_AddPolyToScene(p->pshader, 4, verts);
+		CG_PB_AddPoly(p->pshader, 4, verts);
 	}
 }
 
@@ -1005,9 +1005,9 @@ void CG_AddParticleToScene(cparticle_t *p, vec3_t org, float alpha)
 static float roll = 0.0f;
 
 /**
- * @brief CG_AddParticles
+ * @brief Move, fade and expire the active particles and batch their polys
  */
-void CG_AddParticles(void)
+static void CG_UpdateParticles(void)
 {
 	cparticle_t *p, *next;
 	float       alpha;
@@ -1128,6 +1128,17 @@ void CG_AddParticles(void)
 	active_particles = active;
 }
 
+/**
+ * @brief CG_AddParticles
+ */
+void CG_AddParticles(void)
+{
+	CG_UpdateParticles();
+
+	// submit here so every view adding particles gets its own polys
+	CG_PB_RenderPolyBatches();
+}
+
 /**
  * @brief CG_ParticleSnowFlurry
  * @param[in] pshader
@@ -2363,3 +2374,85 @@ void CG_ParticleDust(centity_t *cent, vec3_t origin, vec3_t dir)
 		p->alpha = 0.75f;
 	}
 }
+
+#ifdef ETLEGACY_DEBUG
+/**
+ * @brief Fill the particle pool with smoke quads and weather triangles around
+ * the view and time the particle update and poly batching on it
+ * @note The batched polys are dropped instead of being added to the scene,
+ * repeated passes would only overflow r_maxpolys. The particles are cleared afterwards.
+ */
+void CG_ParticleBenchmark_f(void)
+{
+	char         buf[MAX_TOKEN_CHARS];
+	cparticle_t  *p;
+	int          seed = 0x1234567;
+	int          count, frames;
+	int          i, start, msec;
+
+	if (!cg.snap)
+	{
+		CG_Printf("particlebench: not in game\n");
+		return;
+	}
+
+	trap_Argv(1, buf, sizeof(buf));
+	count = trap_Argc() > 1 ? Q_atoi(buf) : MAX_PARTICLES;
+	trap_Argv(2, buf, sizeof(buf));
+	frames = trap_Argc() > 2 ? Q_atoi(buf) : 100;
+
+	count  = MAX(1, MIN(count, MAX_PARTICLES));
+	frames = MAX(1, frames);
+
+	CG_ClearParticles();
+
+	for (i = 0; i < count && free_particles; i++)
+	{
+		p              = free_particles;
+		free_particles = p->next;
+		Com_Memset(p, 0, sizeof(*p));
+		p->next          = active_particles;
+		active_particles = p;
+
+		p->time    = cg.time;
+		p->endtime = cg.time + 60000;
+		p->alpha   = 0.5f;
+		p->width   = p->height = 8.f;
+		p->link    = qtrue;
+
+		p->org[0] = cg.refdef_current->vieworg[0] + (Q_RandomFloat(&seed) - 0.5f) * 1024.f;
+		p->org[1] = cg.refdef_current->vieworg[1] + (Q_RandomFloat(&seed) - 0.5f) * 1024.f;
+		p->org[2] = cg.refdef_current->vieworg[2] + (Q_RandomFloat(&seed) - 0.5f) * 512.f;
+		VectorSet(p->vel, 0, 0, 20.f * Q_RandomFloat(&seed));
+
+		if (i & 1)
+		{
+			p->type    = P_WEATHER;
+			p->pshader = cgs.media.snowShader;
+			p->start   = p->org[2] + 256.f;
+			p->end     = p->org[2] - 256.f;
+			VectorSet(p->vel, 0, 0, -p->vel[2]);
+		}
+		else
+		{
+			p->type      = P_SMOKE_IMPACT;
+			p->pshader   = cgs.media.smokePuffShader;
+			p->endwidth  = p->endheight = 16.f;
+			p->startfade = cg.time + 100;
+			p->rotate    = qtrue;
+		}
+	}
+
+	start = trap_Milliseconds();
+	for (i = 0; i < frames; i++)
+	{
+		CG_UpdateParticles();
+		CG_PB_ClearPolyBatches();
+	}
+	msec = trap_Milliseconds() - start;
+
+	CG_ClearParticles();
+
+	CG_Printf("particlebench: %i particles, %i passes, %i msec (%.3f msec/pass)\n", count, frames, msec, msec / (float)frames);
+}
+#endif
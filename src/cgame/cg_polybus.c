@@ -122,3 +122,110 @@ void CG_PB_RenderPolyBuffers(void)
 		}
 	}
 }
+
+#define MAX_PB_BATCHES      8
+#define MAX_PB_BATCH_POLYS  256
+
+/**
+ * @struct polyBatch_s
+ * @brief Polys sharing a shader and vertex count, handed to the renderer in one call
+ */
+typedef struct polyBatch_s
+{
+	qhandle_t shader;
+	int numVerts;                   ///< per poly
+	int numPolys;
+	polyVert_t verts[MAX_PB_BATCH_POLYS * 4];
+} polyBatch_t;
+
+static polyBatch_t cg_polyBatches[MAX_PB_BATCHES];
+
+/**
+ * @brief CG_PB_SubmitPolyBatch
+ * @param[in,out] batch
+ *
+ * @note Unlike a poly buffer, RE_AddPolysToScene picks the fog volume for every poly
+ */
+static void CG_PB_SubmitPolyBatch(polyBatch_t *batch)
+{
+	if (batch->numPolys)
+	{
+		trap_R_AddPolysToScene(batch->shader, batch->numVerts, batch->verts, batch->numPolys);
+		batch->numPolys = 0;
+	}
+}
+
+/**
+ * @brief Batch a poly with others using the same shader, for many small polys
+ * which can be spread over different fog volumes like particles
+ * @param[in] shader
+ * @param[in] numVerts 3 or 4
+ * @param[in] verts
+ */
+void CG_PB_AddPoly(qhandle_t shader, int numVerts, const polyVert_t *verts)
+{
+	polyBatch_t *batch;
+	polyBatch_t *freeBatch = NULL;
+	int         i;
+
+	for (i = 0; i < MAX_PB_BATCHES; i++)
+	{
+		batch = &cg_polyBatches[i];
+
+		if (!batch->numPolys)
+		{
+			if (!freeBatch)
+			{
+				freeBatch = batch;
+			}
+			continue;
+		}
+
+		if (batch->shader == shader && batch->numVerts == numVerts)
+		{
+			break;
+		}
+	}
+
+	if (i == MAX_PB_BATCHES)
+	{
+		// all batches are taken by other shaders, make room in the first one
+		batch = freeBatch ? freeBatch : &cg_polyBatches[0];
+		CG_PB_SubmitPolyBatch(batch);
+		batch->shader   = shader;
+		batch->numVerts = numVerts;
+	}
+	else if (batch->numPolys == MAX_PB_BATCH_POLYS)
+	{
+		CG_PB_SubmitPolyBatch(batch);
+	}
+
+	Com_Memcpy(&batch->verts[batch->numPolys * numVerts], verts, numVerts * sizeof(*verts));
+	batch->numPolys++;
+}
+
+/**
+ * @brief Hand all batched polys to the renderer, must be called before the scene they belong to is rendered
+ */
+void CG_PB_RenderPolyBatches(void)
+{
+	int i;
+
+	for (i = 0; i < MAX_PB_BATCHES; i++)
+	{
+		CG_PB_SubmitPolyBatch(&cg_polyBatches[i]);
+	}
+}
+
+/**
+ * @brief Drop all batched polys without rendering them
+ */
+void CG_PB_ClearPolyBatches(void)
+{
+	int i;
+
+	for (i = 0; i < MAX_PB_BATCHES; i++)
+	{
+		cg_polyBatches[i].numPolys = 0;
+	}
+}
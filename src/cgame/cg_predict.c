@@ -201,8 +201,34 @@ static void CG_ClipMoveToEntities(const vec3_t start, const vec3_t mins, const v
 	clipHandle_t  cmodel;
 	vec3_t        bmins, bmaxs;
 	vec3_t        origin, angles;
+	vec3_t        traceMins, traceMaxs;
 	centity_t     *cent;
 
+	// point traces pass NULL boxes
+	if (!mins)
+	{
+		mins = vec3_origin;
+	}
+	if (!maxs)
+	{
+		maxs = vec3_origin;
+	}
+
+	// bounds of the whole move, used to skip boxes the trace can't touch
+	for (i = 0 ; i < 3 ; i++)
+	{
+		if (end[i] > start[i])
+		{
+			traceMins[i] = start[i] + mins[i] - 1;
+			traceMaxs[i] = end[i] + maxs[i] + 1;
+		}
+		else
+		{
+			traceMins[i] = end[i] + mins[i] - 1;
+			traceMaxs[i] = start[i] + maxs[i] + 1;
+		}
+	}
+
 	for (i = 0 ; i < cg_numSolidEntities ; i++)
 	{
 		cent = cg_solidEntities[i];
@@ -255,11 +281,21 @@ static void CG_ClipMoveToEntities(const vec3_t start, const vec3_t mins, const v
 				}
 			}
 
+			VectorCopy(cent->lerpOrigin, origin);
+
+			// axial box, reject it here instead of paying for
+			// the temp model and the transformed trace
+			if (origin[0] + bmins[0] > traceMaxs[0] || origin[0] + bmaxs[0] < traceMins[0]
+			    || origin[1] + bmins[1] > traceMaxs[1] || origin[1] + bmaxs[1] < traceMins[1]
+			    || origin[2] + bmins[2] > traceMaxs[2] || origin[2] + bmaxs[2] < traceMins[2])
+			{
+				continue;
+			}
+
 			//cmodel = trap_CM_TempCapsuleModel( bmins, bmaxs );
 			cmodel = trap_CM_TempBoxModel(bmins, bmaxs);
 
 			VectorCopy(vec3_origin, angles);
-			VectorCopy(cent->lerpOrigin, origin);
 		}
 		// use bbox of capsule
 		if (capsule)
@@ -987,15 +1023,14 @@ const char *predictionStrings[] =
  * For normal gameplay, it will be the result of predicted usercmd_t on
  * top of the most recent playerState_t received from the server.
  *
- * Each new snapshot will usually have one or more new usercmd over the last,
- * but we simulate all unacknowledged commands each time, not just the new ones.
- * This means that on an internet connection, quite a few pmoves may be issued
- * each frame.
- *
- * OPTIMIZE: don't re-simulate unless the newly arrived snapshot playerState_t
- * differs from the predicted one.  Would require saving all intermediate
- * playerState_t during prediction. (this is "dead reckoning" and would definately
- * be nice to have in there
+ * Each new snapshot will usually have one or more new usercmd over the last.
+ * With cg_optimizePrediction the intermediate playerState_t of every predicted
+ * command is kept in cg.backupStates, and as long as a new snapshot agrees with
+ * the saved state (CG_PredictionOk) only the new commands are simulated, the
+ * older ones are played back. Without it, or after a prediction error, all
+ * unacknowledged commands are simulated again, which on an internet connection
+ * means quite a few pmoves each frame. cg.numPredictedCmds and cg.numPlayedBackCmds
+ * count both cases for the last frame (cg_showmiss 2 prints them).
  *
  * We detect prediction errors and allow them to be decayed off over several frames
  * to ease the jerk.
@@ -1011,10 +1046,12 @@ void CG_PredictPlayerState(void)
 	pmoveExt_t    pmext;
 	// unlagged - optimized prediction
 	int stateIndex = 0, predictCmd = 0;
-	int numPredicted = 0, numPlayedBack = 0; // debug code
 
 	cg.hyperspace = qfalse; // will be set if touching a trigger_teleport
 
+	cg.numPredictedCmds  = 0;
+	cg.numPlayedBackCmds = 0;
+
 	// if this is the first frame we must guarantee
 	// predictedPlayerState is valid even if there is some
 	// other error condition
@@ -1203,6 +1240,7 @@ void CG_PredictPlayerState(void)
 			cg.lastPredictedCommand = 0;
 			cg.backupStateTail      = cg.backupStateTop;
 			predictCmd              = current - cg.cmdBackup + 1;
+			cg.numFullPredicts++;
 		}
 		// cg.physicsTime is the current snapshot's serverTime
 		// if it's the same as the last one
@@ -1259,6 +1297,7 @@ void CG_PredictPlayerState(void)
 				cg.lastPredictedCommand = 0;
 				cg.backupStateTail      = cg.backupStateTop;
 				predictCmd              = current - cg.cmdBackup + 1;
+				cg.numFullPredicts++;
 			}
 		}
 
@@ -1283,10 +1322,8 @@ void CG_PredictPlayerState(void)
 	predictError = qtrue;
 	for (; cmdNum <= current ; cmdNum++)
 	{
-		// get the command
+		// get the command, the previous one is only fetched when Pmove actually runs
 		trap_GetUserCmd(cmdNum, &cg_pmove.cmd);
-		// get the previous command
-		trap_GetUserCmd(cmdNum - 1, &cg_pmove.oldcmd);
 
 		// check for a prediction error from last frame
 		// on a lan, this will often be the exact value
@@ -1425,8 +1462,6 @@ void CG_PredictPlayerState(void)
 		// current predicted data if this is the current cmd)  (#166)
 		Com_Memcpy(&pmext, &oldpmext[cmdNum & cg.cmdMask], sizeof(pmoveExt_t));
 
-		fflush(stdout);
-
 		// unlagged - optimized prediction
 		// we check for cg_latentCmds because it'll mess up the optimization
 		if (cg_optimizePrediction.integer)
@@ -1435,9 +1470,10 @@ void CG_PredictPlayerState(void)
 			if (cmdNum >= predictCmd || (stateIndex + 1) % MAX_BACKUP_STATES == cg.backupStateTop)
 			{
 				// run the Pmove
+				trap_GetUserCmd(cmdNum - 1, &cg_pmove.oldcmd);
 				Pmove(&cg_pmove);
 
-				numPredicted++; // debug code
+				cg.numPredictedCmds++;
 
 				// record the last predicted command
 				cg.lastPredictedCommand = cmdNum;
@@ -1454,7 +1490,7 @@ void CG_PredictPlayerState(void)
 			}
 			else
 			{
-				numPlayedBack++; // debug code
+				cg.numPlayedBackCmds++;
 
 				if (cg_showmiss.integer && cg.backupStates[stateIndex].commandTime != cg_pmove.cmd.serverTime)
 				{
@@ -1467,14 +1503,19 @@ void CG_PredictPlayerState(void)
 
 				// go to the next element in the saved states array
 				stateIndex = (stateIndex + 1) % MAX_BACKUP_STATES;
+
+				// the objective "You are near" print already ran when this state was predicted
+				moved = qtrue;
+				continue;
 			}
 		}
 		else
 		{
 			// run the Pmove
+			trap_GetUserCmd(cmdNum - 1, &cg_pmove.oldcmd);
 			Pmove(&cg_pmove);
 
-			numPredicted++; // debug code
+			cg.numPredictedCmds++;
 		}
 		// unlagged - optimized prediction
 
@@ -1488,7 +1529,7 @@ void CG_PredictPlayerState(void)
 	// do a /condump after a few seconds of this
 	if (cg_showmiss.integer & 2)
 	{
-		CG_Printf("cg.time: %d, numPredicted: %d, numPlayedBack: %d\n", cg.time, numPredicted, numPlayedBack); // debug code
+		CG_Printf("cg.time: %d, numPredicted: %d, numPlayedBack: %d, numFullPredicts: %d\n", cg.time, cg.numPredictedCmds, cg.numPlayedBackCmds, cg.numFullPredicts);
 	}
 	// if everything is working right, numPredicted should be 1 more than 98%
 	// of the time, meaning only ONE predicted move was done in the frame
@@ -47,6 +47,7 @@ static ext_trap_keys_t cg_extensionTraps[] =
 	{ "trap_CmdBackup_Ext_Legacy",      CG_CMDBACKUP_EXT,        qfalse },
 	{ "trap_MatchPaused_Legacy",        CG_MATCHPAUSED,          qfalse },
 	{ "trap_CvarSetDescription_Legacy", CG_CVAR_SET_DESCRIPTION, qfalse },
+	{ "trap_CvarGetModified_Legacy",    CG_CVAR_GET_MODIFIED,    qfalse },
 	{ NULL,                             -1,                      qfalse }
 };
 
@@ -1132,6 +1133,9 @@ intptr_t CL_CgameSystemCalls(intptr_t *args)
 	case CG_CVAR_SET_DESCRIPTION:
 		return Cvar_SetDescriptionByName(VMA(1), VMA(2));
 
+	case CG_CVAR_GET_MODIFIED:
+		return Cvar_JournalRead(CVAR_JOURNAL_CGAME, VMA(1), args[2]);
+
 	default:
 		Com_Error(ERR_DROP, "Bad cgame system trap: %ld", (long int) args[0]);
 		break;
@@ -1271,6 +1275,8 @@ void CL_InitCGame(void)
 	// mark all extensions as inactive
 	VM_Ext_ResetActive();
 
+	Cvar_JournalReset(CVAR_JOURNAL_CGAME);
+
 	// load the dll
 	cgvm = VM_Create("cgame", qtrue, CL_CgameSystemCalls, VMI_NATIVE);
 	if (!cgvm)
@@ -45,6 +45,10 @@
 
 #include <theora/theora.h>
 
+#ifdef ETL_SSE
+#include <immintrin.h>
+#endif
+
 #define OGG_BUFFER_SIZE (8 * 1024)  //4096
 #define OGG_SAMPLEWIDTH 2
 
@@ -269,6 +273,72 @@ static qboolean OGV_CheckFrame(yuv_buffer *yuv, theora_info *info)
 }
 */
 
+#ifdef ETL_SSE
+/**
+ * @brief Convert 8 pixels of a line with horizontally halved chroma
+ *
+ * Same integer math as the scalar loop: each madd pairs a luma or chroma
+ * term with its factor, the saturating packs do the byte clamping.
+ *
+ * @param[in] yp 8 luma samples
+ * @param[in] up 4 chroma samples
+ * @param[in] vp 4 chroma samples
+ * @param[out] output 8 RGBA pixels
+ */
+static ID_INLINE void OGV_yuv_to_rgb24_sse(const unsigned char *yp, const unsigned char *up, const unsigned char *vp, uint32_t *output)
+{
+	const __m128i zero  = _mm_setzero_si128();
+	const __m128i round = _mm_set1_epi32(128);
+	const __m128i kyv_r = _mm_setr_epi16(298, 409, 298, 409, 298, 409, 298, 409);
+	const __m128i kyv_g = _mm_setr_epi16(298, -100, 298, -100, 298, -100, 298, -100);
+	const __m128i ku_g  = _mm_setr_epi16(-208, 128, -208, 128, -208, 128, -208, 128);
+	const __m128i kyu_b = _mm_setr_epi16(298, 516, 298, 516, 298, 516, 298, 516);
+	const __m128i one   = _mm_set1_epi16(1);
+	__m128i       y, u, v, yv, yu, u1, r[2], g[2], b[2], rg, ba;
+	int           uu, vv, k;
+
+	Com_Memcpy(&uu, up, 4);
+	Com_Memcpy(&vv, vp, 4);
+
+	y = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)yp), zero), _mm_set1_epi16(16));
+	u = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(uu), zero), _mm_set1_epi16(128));
+	v = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(vv), zero), _mm_set1_epi16(128));
+	// every chroma sample covers two pixels
+	u = _mm_unpacklo_epi16(u, u);
+	v = _mm_unpacklo_epi16(v, v);
+
+	for (k = 0; k < 2; k++)
+	{
+		if (k == 0)
+		{
+			yv = _mm_unpacklo_epi16(y, v);
+			yu = _mm_unpacklo_epi16(y, u);
+			u1 = _mm_unpacklo_epi16(u, one);
+		}
+		else
+		{
+			yv = _mm_unpackhi_epi16(y, v);
+			yu = _mm_unpackhi_epi16(y, u);
+			u1 = _mm_unpackhi_epi16(u, one);
+		}
+
+		r[k] = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(yv, kyv_r), round), 8);
+		g[k] = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(yv, kyv_g), _mm_madd_epi16(u1, ku_g)), 8);
+		b[k] = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(yu, kyu_b), round), 8);
+	}
+
+	r[0] = _mm_packs_epi32(r[0], r[1]);
+	g[0] = _mm_packs_epi32(g[0], g[1]);
+	b[0] = _mm_packs_epi32(b[0], b[1]);
+
+	rg = _mm_unpacklo_epi8(_mm_packus_epi16(r[0], r[0]), _mm_packus_epi16(g[0], g[0]));
+	ba = _mm_unpacklo_epi8(_mm_packus_epi16(b[0], b[0]), _mm_set1_epi8((char)0xff));
+
+	_mm_storeu_si128((__m128i *)output, _mm_unpacklo_epi16(rg, ba));
+	_mm_storeu_si128((__m128i *)(output + 4), _mm_unpackhi_epi16(rg, ba));
+}
+#endif
+
 /**
  * @brief OGV_yuv_to_rgb24
  * @param[in] yuv
@@ -278,7 +348,7 @@ static qboolean OGV_CheckFrame(yuv_buffer *yuv, theora_info *info)
  */
 static qboolean OGV_yuv_to_rgb24(yuv_buffer *yuv, theora_info *info, uint32_t *output)
 {
-	int i, j;
+	int i, j, k;
 	int uv_ki = yuv->y_width / yuv->uv_width;
 	int uv_kj = yuv->y_height / yuv->uv_height;
 
@@ -293,13 +363,27 @@ static qboolean OGV_yuv_to_rgb24(yuv_buffer *yuv, theora_info *info, uint32_t *o
 	}
 	*/
 
-	//FIXME: this is slow as fuck, might want to rewrite and use precalculated tables
 	for (j = 0; j < info->height; j++)
 	{
 		y_p  = y_offset + j * yuv->y_stride;
 		uv_p = uv_offset + j / uv_kj * yuv->uv_stride;
+		i    = 0;
+
+#ifdef ETL_SSE
+		// 4:2:0 and 4:2:2, which is what theora encoders produce by default
+		if (uv_ki == 2)
+		{
+			for ( ; i + 8 <= (int)info->width; i += 8)
+			{
+				OGV_yuv_to_rgb24_sse(yuv->y + y_p, yuv->u + uv_p, yuv->v + uv_p, output);
+				output += 8;
+				y_p    += 8;
+				uv_p   += 4;
+			}
+		}
+#endif
 
-		for (i = 0; i < info->width; i++)
+		for (k = 0; i < (int)info->width; i++)
 		{
 			//http://en.wikipedia.org/wiki/YUV
 			int y = yuv->y[y_p] - 16;
@@ -313,8 +397,9 @@ static qboolean OGV_yuv_to_rgb24(yuv_buffer *yuv, theora_info *info, uint32_t *o
 			++output;
 
 			y_p++;
-			if (i % uv_ki == uv_ki - 1)
+			if (++k == uv_ki)
 			{
+				k = 0;
 				uv_p++;
 			}
 		}
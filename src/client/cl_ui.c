@@ -49,6 +49,7 @@ extern botlib_export_t *botlib_export;
 static ext_trap_keys_t ui_extensionTraps[] =
 {
 	{ "trap_CvarSetDescription_Legacy", UI_CVAR_SET_DESCRIPTION, qfalse },
+	{ "trap_CvarGetModified_Legacy",    UI_CVAR_GET_MODIFIED,    qfalse },
 	{ NULL,                             -1,                      qfalse }
 };
 
@@ -1360,6 +1361,8 @@ intptr_t CL_UISystemCalls(intptr_t *args)
 		return VM_Ext_GetValue(VMA(1), args[2], VMA(3));
 	case UI_CVAR_SET_DESCRIPTION:
 		return Cvar_SetDescriptionByName(VMA(1), VMA(2));
+	case UI_CVAR_GET_MODIFIED:
+		return Cvar_JournalRead(CVAR_JOURNAL_UI, VMA(1), args[2]);
 	default:
 		Com_Error(ERR_DROP, "Bad UI system trap: %ld", (long int) args[0]);
 	}
@@ -1393,6 +1396,8 @@ void CL_InitUI(void)
 	// mark all extensions as inactive
 	VM_Ext_ResetActive();
 
+	Cvar_JournalReset(CVAR_JOURNAL_UI);
+
 	uivm = VM_Create("ui", qtrue, CL_UISystemCalls, VMI_NATIVE);
 	if (!uivm)
 	{
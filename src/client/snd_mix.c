@@ -38,6 +38,9 @@
 #if idppc_altivec && !defined(__APPLE__)
 #include <altivec.h>
 #endif
+#ifdef ETL_SSE
+#include <immintrin.h>
+#endif
 
 static portable_samplepair_t paintbuffer[PAINTBUFFER_SIZE];
 static int                   snd_vol;
@@ -53,10 +56,21 @@ short *snd_out;
  */
 void S_WriteLinearBlastStereo16(void)
 {
-	int i;
+	int i = 0;
 	int val;
 
-	for (i = 0 ; i < snd_linear_count ; i += 2)
+#ifdef ETL_SSE
+	// the saturating pack does the same clamping as below, 8 samples at a time
+	for ( ; i + 8 <= snd_linear_count ; i += 8)
+	{
+		__m128i lo = _mm_srai_epi32(_mm_loadu_si128((const __m128i *)(snd_p + i)), 8);
+		__m128i hi = _mm_srai_epi32(_mm_loadu_si128((const __m128i *)(snd_p + i + 4)), 8);
+
+		_mm_storeu_si128((__m128i *)(snd_out + i), _mm_packs_epi32(lo, hi));
+	}
+#endif
+
+	for ( ; i < snd_linear_count ; i += 2)
 	{
 		val = snd_p[i] >> 8;
 		if (val > 0x7fff)
@@ -528,18 +542,38 @@ static void S_PaintChannelFrom16_scalar(channel_t *ch, const sfx_t *sc, int coun
 
 	if (!ch->doppler || ch->dopplerScale == 1.0f)
 	{
+		int run;
+
 		leftvol  = ch->leftvol * snd_vol;
 		rightvol = ch->rightvol * snd_vol;
 		samples  = chunk->sndChunk;
-		for (i = 0 ; i < count ; i++)
+
+		// mix in runs up to the end of the current chunk, keeping the
+		// channel count and chunk checks out of the inner loops lets
+		// the compiler vectorize them
+		for (i = 0 ; i < count ; i += run)
 		{
-			data          = samples[sampleOffset++];
-			samp[i].left += (data * leftvol) >> 8;
-			if (sc->soundChannels == 2 && sampleOffset < SND_CHUNK_SIZE)
+			if (sc->soundChannels == 2)
 			{
-				data = samples[sampleOffset++];
+				run = MIN(count - i, (SND_CHUNK_SIZE - sampleOffset) >> 1);
+				for (j = 0 ; j < run ; j++)
+				{
+					samp[i + j].left  += (samples[sampleOffset + (j << 1)] * leftvol) >> 8;
+					samp[i + j].right += (samples[sampleOffset + (j << 1) + 1] * rightvol) >> 8;
+				}
+				sampleOffset += run << 1;
+			}
+			else
+			{
+				run = MIN(count - i, SND_CHUNK_SIZE - sampleOffset);
+				for (j = 0 ; j < run ; j++)
+				{
+					data               = samples[sampleOffset + j];
+					samp[i + j].left  += (data * leftvol) >> 8;
+					samp[i + j].right += (data * rightvol) >> 8;
+				}
+				sampleOffset += run;
 			}
-			samp[i].right += (data * rightvol) >> 8;
 
 			if (sampleOffset == SND_CHUNK_SIZE)
 			{
@@ -964,6 +964,9 @@ void BG_AnimParseAnimScript(animModelInfo_t *animModelInfo, animScriptData_t *sc
 	// the scriptData passed into here must be the one this binary is using
 	globalScriptData = scriptData;
 
+	// script items are about to change, forget what BG_FirstValidItem found
+	Com_Memset(scriptData->clientMemo, 0, sizeof(scriptData->clientMemo));
+
 	// init the global defines
 	globalFilename = filename;
 	Com_Memset(defineStr, 0, sizeof(defineStr));
@@ -1285,6 +1288,7 @@ qboolean BG_EvaluateConditions(int client, animScriptItem_t *scriptItem)
 	int                   i;
 	animScriptCondition_t *cond;
 	qboolean              passed;
+	int                   (*clientConditions)[2] = globalScriptData->clientConditions[client];
 
 	for (i = 0, cond = scriptItem->conditions; i < scriptItem->numConditions; i++, cond++)
 	{
@@ -1293,14 +1297,14 @@ qboolean BG_EvaluateConditions(int client, animScriptItem_t *scriptItem)
 		switch (animConditionsTable[cond->index].type)
 		{
 		case ANIM_CONDTYPE_BITFLAGS:
-			if (!(globalScriptData->clientConditions[client][cond->index][0] & cond->value[0]) &&
-			    !(globalScriptData->clientConditions[client][cond->index][1] & cond->value[1]))
+			if (!(clientConditions[cond->index][0] & cond->value[0]) &&
+			    !(clientConditions[cond->index][1] & cond->value[1]))
 			{
 				passed = qfalse;
 			}
 			break;
 		case ANIM_CONDTYPE_VALUE:
-			if (!(globalScriptData->clientConditions[client][cond->index][0] == cond->value[0]))
+			if (!(clientConditions[cond->index][0] == cond->value[0]))
 			{
 				passed = qfalse;
 			}
@@ -1329,6 +1333,10 @@ qboolean BG_EvaluateConditions(int client, animScriptItem_t *scriptItem)
 
 /**
  * @brief scroll through the script items, returning the first script found to pass all conditions
+ *
+ * The result only depends on the script and the client conditions, so it is
+ * remembered per client until one of the conditions changes.
+ *
  * @param[in] client
  * @param[in] script
  * @return NULL if no match found
@@ -1336,17 +1344,30 @@ qboolean BG_EvaluateConditions(int client, animScriptItem_t *scriptItem)
 animScriptItem_t *BG_FirstValidItem(int client, animScript_t *script)
 {
 	animScriptItem_t **ppScriptItem;
+	animScriptItem_t *item = NULL;
+	animScriptMemo_t *memo;
 	int              i;
 
+	memo = &globalScriptData->clientMemo[client][((intptr_t)script / sizeof(animScript_t)) & (MAX_ANIMSCRIPT_MEMO - 1)];
+	if (memo->script == script && memo->conditionsCount == globalScriptData->clientConditionsCount[client])
+	{
+		return memo->item;
+	}
+
 	for (i = 0, ppScriptItem = script->items; i < script->numItems; i++, ppScriptItem++)
 	{
 		if (BG_EvaluateConditions(client, *ppScriptItem))
 		{
-			return *ppScriptItem;
+			item = *ppScriptItem;
+			break;
 		}
 	}
 
-	return NULL;
+	memo->script          = script;
+	memo->item            = item;
+	memo->conditionsCount = globalScriptData->clientConditionsCount[client];
+
+	return item;
 }
 
 /*
@@ -1756,6 +1777,8 @@ char *BG_GetAnimString(animModelInfo_t *animModelInfo, int anim)
  */
 void BG_UpdateConditionValue(int client, int condition, int value, qboolean checkConversion)
 {
+	int *clientCondition = globalScriptData->clientConditions[client][condition];
+
 	// fixed checkConversion brained-damagedness, which would try
 	// to BitSet an insane value if checkConversion was false but this
 	// anim was ANIM_CONDTYPE_BITFLAGS
@@ -1766,16 +1789,28 @@ void BG_UpdateConditionValue(int client, int condition, int value, qboolean chec
 			// we may need to convert to bitflags
 			// We want to set the ScriptData to the explicit value passed in.
 			//              COM_BitSet will OR values on top of each other, so clear it first.
-			globalScriptData->clientConditions[client][condition][0] = 0;
-			globalScriptData->clientConditions[client][condition][1] = 0;
+			int bits[2] = { 0, 0 };
+
+			COM_BitSet(bits, value);
 
-			COM_BitSet(globalScriptData->clientConditions[client][condition], value);
+			if (clientCondition[0] != bits[0] || clientCondition[1] != bits[1])
+			{
+				clientCondition[0] = bits[0];
+				clientCondition[1] = bits[1];
+				globalScriptData->clientConditionsCount[client]++;
+			}
 			return;
 		}
 		// we must fall through here because a bunch of non-bitflag
 		// conditions are set with checkConversion == qtrue
 	}
-	globalScriptData->clientConditions[client][condition][0] = value;
+
+	// most updates are done every frame with the same value, keep the memo of BG_FirstValidItem
+	if (clientCondition[0] != value)
+	{
+		clientCondition[0] = value;
+		globalScriptData->clientConditionsCount[client]++;
+	}
 }
 
 /**
@@ -1848,6 +1883,7 @@ qboolean BG_GetConditionBitFlag(int client, int condition, int bitNumber)
 void BG_SetConditionBitFlag(int client, int condition, int bitNumber)
 {
 	COM_BitSet(globalScriptData->clientConditions[client][condition], bitNumber);
+	globalScriptData->clientConditionsCount[client]++;
 }
 
 /**
@@ -1859,6 +1895,7 @@ void BG_SetConditionBitFlag(int client, int condition, int bitNumber)
 void BG_ClearConditionBitFlag(int client, int condition, int bitNumber)
 {
 	COM_BitClear(globalScriptData->clientConditions[client][condition], bitNumber);
+	globalScriptData->clientConditionsCount[client]++;
 }
 
 /**
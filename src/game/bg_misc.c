@@ -4991,3 +4991,53 @@ void BG_LegsCollisionBoxOffset(vec3_t viewangles, int eFlags, vec3_t legsOffset)
 		VectorScale(flatforward, -32, legsOffset);
 	}
 }
+
+void trap_Cvar_Update(vmCvar_t *vmCvar);
+int trap_Cvar_GetModified(int *handles, int maxHandles);
+
+/**
+ * @brief Read the engine's journal of cvars modified since the last call
+ * @param[out] journal
+ */
+void BG_FetchModifiedCvars(modifiedCvars_t *journal)
+{
+	int handles[64];
+	int count, i;
+
+	Com_Memset(journal->modified, 0, sizeof(journal->modified));
+
+	// -1 without engine support, every cvar has to be updated then
+	count              = trap_Cvar_GetModified(handles, ARRAY_LEN(handles));
+	journal->journaled = count >= 0 ? qtrue : qfalse;
+
+	while (count > 0)
+	{
+		for (i = 0; i < count; i++)
+		{
+			if ((unsigned)handles[i] < MAX_CVAR_HANDLES)
+			{
+				COM_BitSet(journal->modified, handles[i]);
+			}
+		}
+
+		if (count < (int)ARRAY_LEN(handles))
+		{
+			break;
+		}
+
+		count = trap_Cvar_GetModified(handles, ARRAY_LEN(handles));
+	}
+}
+
+/**
+ * @brief Sync a vmCvar with the engine unless the journal says it is unchanged
+ * @param[in] journal
+ * @param[in,out] vmCvar
+ */
+void BG_UpdateCvar(const modifiedCvars_t *journal, vmCvar_t *vmCvar)
+{
+	if (!journal->journaled || COM_BitCheck(journal->modified, vmCvar->handle))
+	{
+		trap_Cvar_Update(vmCvar);
+	}
+}
@@ -2132,6 +2132,19 @@ void BG_GetMarkDir(const vec3_t dir, const vec3_t normal, vec3_t out);
 
 void BG_AddPredictableEventToPlayerstate(int newEvent, int eventParm, playerState_t *ps);
 
+/**
+ * @struct modifiedCvars_s
+ * @brief Cvars the engine reported as modified, see BG_FetchModifiedCvars
+ */
+typedef struct modifiedCvars_s
+{
+	int modified[MAX_CVAR_HANDLES / 32];    ///< bit per cvar handle
+	qboolean journaled;                     ///< qfalse if the engine has no cvar journal
+} modifiedCvars_t;
+
+void BG_FetchModifiedCvars(modifiedCvars_t *journal);
+void BG_UpdateCvar(const modifiedCvars_t *journal, vmCvar_t *vmCvar);
+
 void BG_PlayerStateToEntityState(playerState_t *ps, entityState_t *s, int time, qboolean snap);
 
 qboolean BG_PlayerTouchesBox(playerState_t *ps, entityState_t *item, int atTime, int sideLength);
@@ -2211,6 +2224,7 @@ typedef enum
 #define MAX_MODEL_ANIMATIONS                512    ///< animations per model
 #define MAX_ANIMSCRIPT_ANIMCOMMANDS         8
 #define MAX_ANIMSCRIPT_ITEMS                128
+#define MAX_ANIMSCRIPT_MEMO                 8      ///< remembered script results per client, must be a power of two
 // NOTE: these must all be in sync with string tables in bg_animation.c
 
 /**
@@ -2428,6 +2442,17 @@ typedef struct
 
 } animModelInfo_t;
 
+/**
+ * @struct animScriptMemo_t
+ * @brief Result of the last BG_FirstValidItem lookup of a script
+ */
+typedef struct
+{
+	animScript_t *script;
+	animScriptItem_t *item;
+	unsigned int conditionsCount;   ///< clientConditionsCount the result is valid for
+} animScriptMemo_t;
+
 /**
  * @struct animScriptData_t
  * @brief This is the main structure that is duplicated on the client and server
@@ -2436,6 +2461,8 @@ typedef struct
 {
 	animModelInfo_t modelInfo[MAX_ANIMSCRIPT_MODELS];
 	int clientConditions[MAX_CLIENTS][NUM_ANIM_CONDITIONS][2];
+	unsigned int clientConditionsCount[MAX_CLIENTS];                ///< bumped whenever a condition of the client changes
+	animScriptMemo_t clientMemo[MAX_CLIENTS][MAX_ANIMSCRIPT_MEMO];
 
 	// pointers to functions from the owning module
 	// constify the arg
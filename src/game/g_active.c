@@ -1475,6 +1475,10 @@ void ClientThink_real(gentity_t *ent)
 
 	pm.activateLean = client->pers.activateLean;
 
+#ifdef ETLEGACY_DEBUG
+	G_PmoveRecord(&pm);
+#endif
+
 	Pmove(&pm); // monsterslick
 
 	// server cursor hints
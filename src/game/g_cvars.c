@@ -733,6 +733,8 @@ void G_RegisterCvars(void)
 	}
 }
 
+static modifiedCvars_t gameCvarJournal;
+
 /**
  * @brief G_UpdateCvars
  */
@@ -749,11 +751,13 @@ void G_UpdateCvars(void)
 	static qboolean xpSaveResetModeInitialized = qfalse;
 #endif
 
+	BG_FetchModifiedCvars(&gameCvarJournal);
+
 	for (i = 0, cv = gameCvarTable ; i < gameCvarTableSize ; i++, cv++)
 	{
 		if (cv->vmCvar)
 		{
-			trap_Cvar_Update(cv->vmCvar);
+			BG_UpdateCvar(&gameCvarJournal, cv->vmCvar);
 
 			if (cv->modificationCount != cv->vmCvar->modificationCount)
 			{
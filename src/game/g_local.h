@@ -1817,6 +1817,7 @@ void FindIntermissionPoint(void);
 void G_RunThink(gentity_t *ent);
 void G_RunEntity(gentity_t *ent, int msec);
 void QDECL G_LogPrintf(const char *fmt, ...) _attribute((format(printf, 1, 2)));
+void G_LogFlush(void);
 void G_LogExit(const char *string);
 void SendScoreboardMessageToAllClients(void);
 void QDECL G_Printf(const char *fmt, ...) _attribute((format(printf, 1, 2)));
@@ -1829,11 +1830,13 @@ void trap_DemoSupport(const char *commands);
 void trap_SnapshotCallbackExt(void);
 void trap_SnapshotSetClientMask(int clientNum, uint64_t mask);
 void trap_Cvar_SetDescription(const char *cvarName, const char *description);
+int trap_Cvar_GetModified(int *handles, int maxHandles);
 extern int dll_com_trapGetValue;
 extern int dll_trap_DemoSupport;
 extern int dll_trap_SnapshotCallbackExt;
 extern int dll_trap_SnapshotSetClientMask;
 extern int dll_trap_CvarSetDescription;
+extern int dll_trap_CvarGetModified;
 
 // g_demo_legacy.c
 void G_DemoStateChanged(demoState_t demoState, int demoClientsNum);
@@ -1853,6 +1856,14 @@ void ClientEndFrame(gentity_t *ent);
 void G_RunClient(gentity_t *ent);
 void ClientThink_cmd(gentity_t *ent, usercmd_t *cmd);
 
+#ifdef ETLEGACY_DEBUG
+// g_pmovebench.c
+void G_PmoveRecord(pmove_t *pm);
+void G_PmoveRecordStop(void);
+void Svcmd_PmoveRecord_f(void);
+void Svcmd_PmoveBench_f(void);
+#endif
+
 // et-antiwarp.c
 void etpro_AddUsercmd(int clientNum, usercmd_t *cmd);
 void DoClientThinks(gentity_t *ent);
@@ -93,6 +93,7 @@ int dll_trap_DemoSupport;
 int dll_trap_SnapshotCallbackExt;
 int dll_trap_SnapshotSetClientMask;
 int dll_trap_CvarSetDescription;
+int dll_trap_CvarGetModified;
 
 /**
  * @brief G_SnapshotCallbackExt
@@ -1403,6 +1404,7 @@ static ID_INLINE void G_SetupExtensions(void)
 		G_SetupExtensionTrap(value, MAX_CVAR_VALUE_STRING, &dll_trap_SnapshotCallbackExt, "trap_SnapshotCallbackExt_Legacy");
 		G_SetupExtensionTrap(value, MAX_CVAR_VALUE_STRING, &dll_trap_SnapshotSetClientMask, "trap_SnapshotSetClientMask_Legacy");
 		G_SetupExtensionTrap(value, MAX_CVAR_VALUE_STRING, &dll_trap_CvarSetDescription, "trap_CvarSetDescription_Legacy");
+		G_SetupExtensionTrap(value, MAX_CVAR_VALUE_STRING, &dll_trap_CvarGetModified, "trap_CvarGetModified_Legacy");
 	}
 }
 
@@ -1910,6 +1912,13 @@ void G_ShutdownGame(int restart)
 	time_t aclock;
 	char   timeFt[32];
 
+	// write out what this frame logged before any shutdown work can go wrong
+	G_LogFlush();
+
+#ifdef ETLEGACY_DEBUG
+	G_PmoveRecordStop();
+#endif
+
 #ifdef FEATURE_DBMS
 	if (level.database.initialized)
 	{
@@ -1967,6 +1976,7 @@ void G_ShutdownGame(int restart)
 	{
 		G_LogPrintf("ShutdownGame:\n");
 		G_LogPrintf("------------------------------------------------------------\n");
+		G_LogFlush();
 		trap_FS_FCloseFile(level.logFile);
 		level.logFile = 0;
 	}
@@ -2943,6 +2953,25 @@ void ExitLevel(void)
 	G_LogPrintf("ExitLevel: executed\n");
 }
 
+static char   logBuffer[16384];
+static size_t logBufferLen;
+
+/**
+ * @brief Write the collected game log lines
+ *
+ * Called at the end of every frame and before the log is closed, so a busy
+ * server does one write per frame instead of one per line. With g_logSync
+ * nothing is collected.
+ */
+void G_LogFlush(void)
+{
+	if (logBufferLen && level.logFile)
+	{
+		trap_FS_Write(logBuffer, logBufferLen, level.logFile);
+	}
+	logBufferLen = 0;
+}
+
 /**
  * @brief Print to the logfile with a time stamp if it is open
  * @param fmt
@@ -3003,7 +3032,24 @@ void QDECL G_LogPrintf(const char *fmt, ...)
 		return;
 	}
 
-	trap_FS_Write(string, strlen(string), level.logFile);
+	l = strlen(string);
+
+	// synced logs must not lose lines if the server dies before the end of the frame
+	if (g_logSync.integer)
+	{
+		G_LogFlush();
+		trap_FS_Write(string, l, level.logFile);
+		return;
+	}
+
+	// lines are collected and written once per frame, see G_LogFlush
+	if (logBufferLen + l > sizeof(logBuffer))
+	{
+		G_LogFlush();
+	}
+
+	Com_Memcpy(logBuffer + logBufferLen, string, l);
+	logBufferLen += l;
 }
 
 void QDECL G_LogPrintf(const char *fmt, ...) _attribute((format(printf, 1, 2)));
@@ -4711,6 +4757,8 @@ void G_RunFrame(int levelTime)
 
 	G_EBS_RunEntities();
 
+	G_LogFlush();
+
 	level.frameStartTime = trap_Milliseconds();
 }
 
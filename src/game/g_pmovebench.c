@@ -0,0 +1,388 @@
+/*
+ * Wolfenstein: Enemy Territory GPL Source Code
+ * Copyright (C) 1999-2010 id Software LLC, a ZeniMax Media company.
+ *
+ * ET: Legacy
+ * Copyright (C) 2012-2024 ET:Legacy team <mail@etlegacy.com>
+ *
+ * This file is part of ET: Legacy - http://www.etlegacy.com
+ *
+ * ET: Legacy is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ET: Legacy is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ET: Legacy. If not, see <http://www.gnu.org/licenses/>.
+ *
+ * In addition, Wolfenstein: Enemy Territory GPL Source Code is also
+ * subject to certain additional terms. You should have received a copy
+ * of these additional terms immediately following the terms and conditions
+ * of the GNU General Public License which accompanied the source code.
+ * If not, please request a copy in writing from id Software at the address below.
+ *
+ * id Software LLC, c/o ZeniMax Media Inc., Suite 120, Rockville, Maryland 20850 USA.
+ */
+/**
+ * @file g_pmovebench.c
+ * @brief Records player moves on a live server and replays them against the
+ * world only, as a timing harness and regression gate for bg_pmove.c
+ *
+ * Every record holds the full Pmove input of one usercmd and the playerstate
+ * a Pmove traced against the world only produced when it was recorded.
+ * Entities are left out on both sides, so a replay on the same map must give
+ * the same playerstates unless the movement code changed.
+ */
+
+#include "g_local.h"
+
+#ifdef ETLEGACY_DEBUG
+
+extern vmCvar_t g_fixedphysics;
+extern vmCvar_t g_fixedphysicsfps;
+extern vmCvar_t g_pronedelay;
+
+#define PMOVEREC_IDENT      (('V' << 24) + ('M' << 16) + ('P' << 8) + 'E')
+#define PMOVEREC_VERSION    1
+#define PMOVEREC_CHUNK      256     ///< records replayed per timing block
+
+/**
+ * @struct pmoveRecHeader_t
+ * @brief The physics cvars change Pmove results, a replay warns if they differ
+ */
+typedef struct
+{
+	int ident;
+	int version;
+	int recordSize;
+	char mapName[MAX_QPATH];
+	int fixedPhysics;
+	int fixedPhysicsFps;
+	int proneDelay;
+} pmoveRecHeader_t;
+
+/**
+ * @struct pmoveRecord_t
+ * @brief Pmove input of one usercmd and the expected result
+ */
+typedef struct
+{
+	playerState_t ps;               ///< before the move
+	pmoveExt_t pmext;
+	usercmd_t cmd, oldcmd;
+	int tracemask;
+	qboolean noFootsteps;
+	qboolean noWeapClips;
+	int gametype;
+	int ltChargeTime;
+	int soldierChargeTime;
+	int engineerChargeTime;
+	int medicChargeTime;
+	int covertopsChargeTime;
+	vec3_t mins, maxs;
+	int skill[SK_NUM_SKILLS];
+	int pmove_fixed;
+	int pmove_msec;
+	qboolean activateLean;
+
+	playerState_t result;           ///< after the move, traced against the world only
+} pmoveRecord_t;
+
+static fileHandle_t pmoveRecFile;
+static int          pmoveRecCount;
+
+static pmoveRecord_t pmoveRecChunk[PMOVEREC_CHUNK];
+static int           pmoveBenchTraces;
+
+/**
+ * @brief World only trace for recording and replay, counts the calls
+ */
+static void G_PmoveBenchTrace(trace_t *results, const vec3_t start, const vec3_t mins, const vec3_t maxs, const vec3_t end, int passEntityNum, int contentMask)
+{
+	pmoveBenchTraces++;
+	trap_TraceCapsuleNoEnts(results, start, mins, maxs, end, passEntityNum, contentMask);
+}
+
+/**
+ * @brief Run a recorded move
+ * @param[in] rec
+ * @param[out] ps Playerstate after the move
+ * @param[out] pmext
+ */
+static void G_PmoveBenchMove(pmoveRecord_t *rec, playerState_t *ps, pmoveExt_t *pmext)
+{
+	pmove_t pm;
+	int     surfaceFlags;
+
+	// copied bytewise, the results are compared with memcmp
+	Com_Memcpy(ps, &rec->ps, sizeof(*ps));
+	Com_Memcpy(pmext, &rec->pmext, sizeof(*pmext));
+
+	Com_Memset(&pm, 0, sizeof(pm));
+
+	pm.ps                  = ps;
+	pm.pmext               = pmext;
+	pm.character           = BG_GetCharacterForPlayerstate(ps);
+	pm.cmd                 = rec->cmd;
+	pm.oldcmd              = rec->oldcmd;
+	pm.tracemask           = rec->tracemask;
+	pm.noFootsteps         = rec->noFootsteps;
+	pm.noWeapClips         = rec->noWeapClips;
+	pm.gametype            = rec->gametype;
+	pm.ltChargeTime        = rec->ltChargeTime;
+	pm.soldierChargeTime   = rec->soldierChargeTime;
+	pm.engineerChargeTime  = rec->engineerChargeTime;
+	pm.medicChargeTime     = rec->medicChargeTime;
+	pm.covertopsChargeTime = rec->covertopsChargeTime;
+	pm.skill               = rec->skill;
+	pm.pmove_fixed         = rec->pmove_fixed;
+	pm.pmove_msec          = rec->pmove_msec;
+	pm.activateLean        = rec->activateLean;
+	pm.trace               = G_PmoveBenchTrace;
+	pm.pointcontents       = trap_PointContents;
+	VectorCopy(rec->mins, pm.mins);
+	VectorCopy(rec->maxs, pm.maxs);
+
+	// Pmove stores the ground surface on the live client, keep it
+	surfaceFlags = g_entities[ps->clientNum].surfaceFlags;
+	Pmove(&pm);
+	g_entities[ps->clientNum].surfaceFlags = surfaceFlags;
+}
+
+/**
+ * @brief Add the move a client is about to make to the open recording
+ * @param[in] pm Set up for the live Pmove, which has not run yet
+ */
+void G_PmoveRecord(pmove_t *pm)
+{
+	pmoveRecord_t rec;
+	pmoveExt_t    pmext;
+
+	if (!pmoveRecFile)
+	{
+		return;
+	}
+
+	Com_Memset(&rec, 0, sizeof(rec));
+
+	rec.ps                  = *pm->ps;
+	rec.pmext               = *pm->pmext;
+	rec.cmd                 = pm->cmd;
+	rec.oldcmd              = pm->oldcmd;
+	rec.tracemask           = pm->tracemask;
+	rec.noFootsteps         = pm->noFootsteps;
+	rec.noWeapClips         = pm->noWeapClips;
+	rec.gametype            = pm->gametype;
+	rec.ltChargeTime        = pm->ltChargeTime;
+	rec.soldierChargeTime   = pm->soldierChargeTime;
+	rec.engineerChargeTime  = pm->engineerChargeTime;
+	rec.medicChargeTime     = pm->medicChargeTime;
+	rec.covertopsChargeTime = pm->covertopsChargeTime;
+	Com_Memcpy(rec.skill, pm->skill, sizeof(rec.skill));
+	rec.pmove_fixed  = pm->pmove_fixed;
+	rec.pmove_msec   = pm->pmove_msec;
+	rec.activateLean = pm->activateLean;
+	VectorCopy(pm->mins, rec.mins);
+	VectorCopy(pm->maxs, rec.maxs);
+
+	G_PmoveBenchMove(&rec, &rec.result, &pmext);
+
+	trap_FS_Write(&rec, sizeof(rec), pmoveRecFile);
+	pmoveRecCount++;
+}
+
+/**
+ * @brief Close the open recording
+ */
+void G_PmoveRecordStop(void)
+{
+	if (!pmoveRecFile)
+	{
+		return;
+	}
+
+	trap_FS_FCloseFile(pmoveRecFile);
+	pmoveRecFile = 0;
+
+	G_Printf("pmoverecord: %i moves recorded\n", pmoveRecCount);
+}
+
+/**
+ * @brief Start or stop recording player moves
+ *
+ * Usage: pmoverecord <name> to start, pmoverecord without a name to stop.
+ * Moves are written to pmove/<name>.pmv
+ */
+void Svcmd_PmoveRecord_f(void)
+{
+	char             name[MAX_QPATH];
+	pmoveRecHeader_t header;
+
+	G_PmoveRecordStop();
+
+	if (trap_Argc() < 2)
+	{
+		return;
+	}
+
+	trap_Argv(1, name, sizeof(name));
+
+	if (trap_FS_FOpenFile(va("pmove/%s.pmv", name), &pmoveRecFile, FS_WRITE) < 0)
+	{
+		G_Printf("pmoverecord: couldn't open pmove/%s.pmv\n", name);
+		pmoveRecFile = 0;
+		return;
+	}
+
+	Com_Memset(&header, 0, sizeof(header));
+	header.ident      = PMOVEREC_IDENT;
+	header.version    = PMOVEREC_VERSION;
+	header.recordSize = sizeof(pmoveRecord_t);
+	Q_strncpyz(header.mapName, level.rawmapname, sizeof(header.mapName));
+	header.fixedPhysics    = g_fixedphysics.integer;
+	header.fixedPhysicsFps = g_fixedphysicsfps.integer;
+	header.proneDelay      = g_pronedelay.integer;
+
+	trap_FS_Write(&header, sizeof(header), pmoveRecFile);
+	pmoveRecCount = 0;
+
+	G_Printf("pmoverecord: recording to pmove/%s.pmv\n", name);
+}
+
+/**
+ * @brief Replay a recording, print the timings and check the playerstates
+ *
+ * Usage: pmovebench <name> [passes]
+ * Each block of moves is replayed passes times to get above the millisecond
+ * timer resolution, the playerstates are compared on the first pass.
+ */
+void Svcmd_PmoveBench_f(void)
+{
+	static const int bucketLimits[] = { 2, 4, 8, 16, 32, 64 };
+	int              buckets[ARRAY_LEN(bucketLimits) + 1];
+	char             name[MAX_QPATH];
+	char             buf[MAX_STRING_TOKENS];
+	fileHandle_t     f;
+	pmoveRecHeader_t header;
+	playerState_t    ps;
+	pmoveExt_t       pmext;
+	int              len, numRecords, numChunk, done;
+	int              passes, pass, i, j, traces;
+	int              msec = 0, start, mismatches = 0, totalTraces = 0;
+
+	if (trap_Argc() < 2)
+	{
+		G_Printf("usage: pmovebench <name> [passes]\n");
+		return;
+	}
+
+	trap_Argv(1, name, sizeof(name));
+	trap_Argv(2, buf, sizeof(buf));
+	passes = trap_Argc() > 2 ? MAX(1, Q_atoi(buf)) : 10;
+
+	len = trap_FS_FOpenFile(va("pmove/%s.pmv", name), &f, FS_READ);
+	if (len < (int)sizeof(header))
+	{
+		G_Printf("pmovebench: couldn't read pmove/%s.pmv\n", name);
+		if (f)
+		{
+			trap_FS_FCloseFile(f);
+		}
+		return;
+	}
+
+	trap_FS_Read(&header, sizeof(header), f);
+	if (header.ident != PMOVEREC_IDENT || header.version != PMOVEREC_VERSION || header.recordSize != sizeof(pmoveRecord_t))
+	{
+		G_Printf("pmovebench: pmove/%s.pmv was recorded by a different build\n", name);
+		trap_FS_FCloseFile(f);
+		return;
+	}
+
+	if (Q_stricmp(header.mapName, level.rawmapname))
+	{
+		G_Printf(S_COLOR_YELLOW "WARNING: pmove/%s.pmv was recorded on %s\n", name, header.mapName);
+	}
+
+	if (header.fixedPhysics != g_fixedphysics.integer || header.fixedPhysicsFps != g_fixedphysicsfps.integer || header.proneDelay != g_pronedelay.integer)
+	{
+		G_Printf(S_COLOR_YELLOW "WARNING: g_fixedphysics, g_fixedphysicsfps or g_pronedelay differ from the recording\n");
+	}
+
+	numRecords = (len - (int)sizeof(header)) / (int)sizeof(pmoveRecord_t);
+	Com_Memset(buckets, 0, sizeof(buckets));
+
+	for (done = 0; done < numRecords; done += numChunk)
+	{
+		numChunk = MIN(numRecords - done, PMOVEREC_CHUNK);
+		trap_FS_Read(pmoveRecChunk, numChunk * sizeof(pmoveRecord_t), f);
+
+		// first pass checks the results and counts the traces of every move
+		start = trap_Milliseconds();
+		for (i = 0; i < numChunk; i++)
+		{
+			pmoveBenchTraces = 0;
+			G_PmoveBenchMove(&pmoveRecChunk[i], &ps, &pmext);
+			traces = pmoveBenchTraces;
+
+			if (memcmp(&ps, &pmoveRecChunk[i].result, sizeof(ps)))
+			{
+				mismatches++;
+			}
+
+			totalTraces += traces;
+			for (j = 0; j < ARRAY_LEN(bucketLimits) && traces >= bucketLimits[j]; j++)
+			{
+			}
+			buckets[j]++;
+		}
+
+		for (pass = 1; pass < passes; pass++)
+		{
+			for (i = 0; i < numChunk; i++)
+			{
+				G_PmoveBenchMove(&pmoveRecChunk[i], &ps, &pmext);
+			}
+		}
+		msec += trap_Milliseconds() - start;
+	}
+
+	trap_FS_FCloseFile(f);
+
+	if (!numRecords)
+	{
+		G_Printf("pmovebench: pmove/%s.pmv holds no moves\n", name);
+		return;
+	}
+
+	G_Printf("pmovebench: %i moves x %i passes, %.3f usec/Pmove, %.2f traces/Pmove\n",
+	         numRecords, passes, msec * 1000.0 / ((double)numRecords * passes), totalTraces / (double)numRecords);
+
+	for (j = 0; j < ARRAY_LEN(buckets); j++)
+	{
+		if (j < ARRAY_LEN(bucketLimits))
+		{
+			G_Printf("  < %2i traces: %i\n", bucketLimits[j], buckets[j]);
+		}
+		else
+		{
+			G_Printf(" >= %2i traces: %i\n", bucketLimits[j - 1], buckets[j]);
+		}
+	}
+
+	if (mismatches)
+	{
+		G_Printf(S_COLOR_RED "pmovebench: %i of %i playerstates differ from the recording\n", mismatches, numRecords);
+	}
+	else
+	{
+		G_Printf("pmovebench: all playerstates match the recording\n");
+	}
+}
+
+#endif // ETLEGACY_DEBUG
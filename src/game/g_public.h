@@ -231,7 +231,8 @@ typedef enum
 	G_DEMOSUPPORT,
 	G_SNAPSHOT_CALLBACK_EXT,
 	G_SNAPSHOT_SETCLIENTMASK,
-	G_CVAR_SET_DESCRIPTION
+	G_CVAR_SET_DESCRIPTION,
+	G_CVAR_GET_MODIFIED
 
 } gameImport_t;
 
@@ -2628,6 +2628,8 @@ static consoleCommandTable_t consoleCommandTable[] =
 	{ "throw",                      Svcmd_Fling                   },
 #ifdef ETLEGACY_DEBUG
 	{ "ae",                         Svcmd_PlayerAnimEvent         },    //ae <playername> <animEvent>
+	{ "pmoverecord",                Svcmd_PmoveRecord_f           },    //pmoverecord [name]
+	{ "pmovebench",                 Svcmd_PmoveBench_f            },    //pmovebench <name> [passes]
 #endif
 	{ "ref",                        Svcmd_Ref_f                   },    // console also gets ref commands
 	{ "passvote",                   Svcmd_PassVote_f              },
@@ -866,3 +866,20 @@ void trap_Cvar_SetDescription(const char *cvarName, const char *description)
 		SystemCall(dll_trap_CvarSetDescription, cvarName, description);
 	}
 }
+
+/**
+ * @brief Extension for fetching the handles of all cvars modified since the last call,
+ *        so the game doesn't need to poll every registered cvar each frame.
+ * @param[out] handles
+ * @param[in] maxHandles
+ * @return number of handles written, -1 if the engine doesn't support the cvar journal
+ */
+int trap_Cvar_GetModified(int *handles, int maxHandles)
+{
+	if (dll_trap_CvarGetModified)
+	{
+		return SystemCall(dll_trap_CvarGetModified, handles, maxHandles);
+	}
+
+	return -1;
+}
@@ -754,6 +754,17 @@ void CM_LoadMap(const char *name, qboolean clientload, unsigned int *checksum)
 	}
 }
 
+/**
+ * @brief Report the number of brush and patch traces run since the map was loaded
+ * @param[out] brushTraces
+ * @param[out] patchTraces
+ */
+void CM_TraceCounts(int *brushTraces, int *patchTraces)
+{
+	*brushTraces = c_brush_traces;
+	*patchTraces = c_patch_traces;
+}
+
 /**
  * @brief CM_ClearMap
  */
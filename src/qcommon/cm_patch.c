@@ -502,6 +502,16 @@ int CM_PlaneEqual(patchPlane_t *p, float plane[4], int *flipped)
 {
 	float invplane[4];
 
+	// most planes already differ in their first normal component or in their
+	// distance, whichever way they face, reject those before the full compare
+	if ((Q_fabs(p->plane[0] - plane[0]) >= NORMAL_EPSILON
+	     && Q_fabs(p->plane[0] + plane[0]) >= NORMAL_EPSILON)
+	    || (Q_fabs(p->plane[3] - plane[3]) >= DIST_EPSILON
+	        && Q_fabs(p->plane[3] + plane[3]) >= DIST_EPSILON))
+	{
+		return qfalse;
+	}
+
 	if (
 		Q_fabs(p->plane[0] - plane[0]) < NORMAL_EPSILON
 		&& Q_fabs(p->plane[1] - plane[1]) < NORMAL_EPSILON
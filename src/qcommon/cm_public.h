@@ -41,6 +41,7 @@
 
 void CM_LoadMap(const char *name, qboolean clientload, unsigned int *checksum);
 void CM_ClearMap(void);
+void CM_TraceCounts(int *brushTraces, int *patchTraces);
 
 clipHandle_t CM_InlineModel(int index);         // 0 = world, 1 + are bmodels
 clipHandle_t CM_TempBoxModel(const vec3_t mins, const vec3_t maxs, qboolean capsule);
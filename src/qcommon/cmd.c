@@ -395,7 +395,8 @@ void Cmd_Echo_f(void)
  */
 typedef struct cmd_function_s
 {
-	struct cmd_function_s *next;
+	struct cmd_function_s *next;                                    ///< next command in alphabetical order
+	struct cmd_function_s *hashNext;                                ///< next command in the same hash bucket
 	char *name;
 	char *description;
 	xcommand_t function;
@@ -407,7 +408,11 @@ static char *cmd_argv[MAX_STRING_TOKENS];                               ///< poi
 static char cmd_tokenized[BIG_INFO_STRING + MAX_STRING_TOKENS];         ///< will have 0 bytes inserted
 static char cmd_cmd[BIG_INFO_STRING];                                   ///< the original command we received (no token processing)
 
-static cmd_function_t *cmd_functions;                                   ///< possible commands to execute
+static cmd_function_t *cmd_functions;                                   ///< possible commands to execute, sorted by name for completion and cmdlist
+
+#define CMD_HASH_SIZE       1024
+static cmd_function_t *cmd_hashTable[CMD_HASH_SIZE];                    ///< case insensitive lookup of cmd_functions
+#define generateHashValue(name) Q_GenerateHashValue(name, CMD_HASH_SIZE, qtrue, qtrue)
 
 /**
  * @brief Cmd_Argc
@@ -773,7 +778,7 @@ cmd_function_t *Cmd_FindCommand(const char *cmd_name)
 {
 	cmd_function_t *cmd;
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next)
+	for (cmd = cmd_hashTable[generateHashValue(cmd_name)]; cmd; cmd = cmd->hashNext)
 	{
 		if (!Q_stricmp(cmd_name, cmd->name))
 		{
@@ -792,7 +797,8 @@ cmd_function_t *Cmd_FindCommand(const char *cmd_name)
  */
 void Cmd_AddSystemCommand(const char *cmd_name, xcommand_t function, const char *description, completionFunc_t complete)
 {
-	cmd_function_t *cmd;
+	cmd_function_t *cmd, **back;
+	long           hash;
 
 	if (!cmd_name || !cmd_name[0])
 	{
@@ -816,8 +822,17 @@ void Cmd_AddSystemCommand(const char *cmd_name, xcommand_t function, const char
 	cmd->name     = CopyString(cmd_name);
 	cmd->function = function;
 	cmd->complete = complete;
-	cmd->next     = cmd_functions;
-	cmd_functions = cmd;
+
+	// keep the list sorted, registering commands is rare compared to completion and cmdlist
+	for (back = &cmd_functions; *back && Q_stricmp((*back)->name, cmd_name) < 0; back = &(*back)->next)
+	{
+	}
+	cmd->next = *back;
+	*back     = cmd;
+
+	hash                = generateHashValue(cmd_name);
+	cmd->hashNext       = cmd_hashTable[hash];
+	cmd_hashTable[hash] = cmd;
 
 	if (description && description[0])
 	{
@@ -836,15 +851,11 @@ void Cmd_AddSystemCommand(const char *cmd_name, xcommand_t function, const char
  */
 void Cmd_SetCommandCompletionFunc(const char *command, completionFunc_t complete)
 {
-	cmd_function_t *cmd;
+	cmd_function_t *cmd = Cmd_FindCommand(command);
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next)
+	if (cmd)
 	{
-		if (!Q_stricmp(command, cmd->name))
-		{
-			cmd->complete = complete;
-			return;
-		}
+		cmd->complete = complete;
 	}
 }
 
@@ -857,14 +868,11 @@ void Cmd_SetCommandCompletionFunc(const char *command, completionFunc_t complete
  */
 void Cmd_SetCommandDescription(const char *command, const char *description)
 {
-	cmd_function_t *cmd;
+	cmd_function_t *cmd = Cmd_FindCommand(command);
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next)
+	if (cmd)
 	{
-		if (!Q_stricmp(command, cmd->name))
-		{
-			cmd->description = CopyString(description);
-		}
+		cmd->description = CopyString(description);
 	}
 }
 
@@ -874,7 +882,7 @@ void Cmd_SetCommandDescription(const char *command, const char *description)
  */
 void Cmd_RemoveCommand(const char *cmd_name)
 {
-	cmd_function_t *cmd, **back = &cmd_functions;
+	cmd_function_t *cmd, **back;
 
 	if (!cmd_name || !cmd_name[0])
 	{
@@ -882,29 +890,34 @@ void Cmd_RemoveCommand(const char *cmd_name)
 		return;
 	}
 
-	while (1)
+	for (back = &cmd_hashTable[generateHashValue(cmd_name)]; *back; back = &(*back)->hashNext)
 	{
-		cmd = *back;
-		if (!cmd)
+		if (!strcmp(cmd_name, (*back)->name))
 		{
-			// command wasn't active
-			return;
+			break;
 		}
-		if (!strcmp(cmd_name, cmd->name))
-		{
-			*back = cmd->next;
+	}
 
-			Z_Free(cmd->name);
+	cmd = *back;
+	if (!cmd)
+	{
+		// command wasn't active
+		return;
+	}
+	*back = cmd->hashNext;
 
-			if (cmd->description)
-			{
-				Z_Free(cmd->description);
-			}
-			Z_Free(cmd);
-			return;
-		}
-		back = &cmd->next;
+	for (back = &cmd_functions; *back != cmd; back = &(*back)->next)
+	{
 	}
+	*back = cmd->next;
+
+	Z_Free(cmd->name);
+
+	if (cmd->description)
+	{
+		Z_Free(cmd->description);
+	}
+	Z_Free(cmd);
 }
 
 /**
@@ -982,22 +995,20 @@ void Cmd_CommandCompletion(void (*callback)(const char *s))
  */
 void Cmd_CompleteArgument(const char *command, char *args, int argNum)
 {
-	cmd_function_t *cmd;
+	cmd_function_t *cmd = Cmd_FindCommand(command);
 
-	for (cmd = cmd_functions; cmd; cmd = cmd->next)
+	if (!cmd)
 	{
-		if (!Q_stricmp(command, cmd->name))
-		{
-			if (cmd->complete)
-			{
-				cmd->complete(args, argNum);
-			}
-			else if (Field_CompleteMod())
-			{
-				Com_DPrintf(S_COLOR_CYAN "Argument completed via CGAme\n");
-			}
-			return;
-		}
+		return;
+	}
+
+	if (cmd->complete)
+	{
+		cmd->complete(args, argNum);
+	}
+	else if (Field_CompleteMod())
+	{
+		Com_DPrintf(S_COLOR_CYAN "Argument completed via CGAme\n");
 	}
 }
 
@@ -1007,7 +1018,7 @@ void Cmd_CompleteArgument(const char *command, char *args, int argNum)
  */
 void Cmd_ExecuteString(const char *text)
 {
-	cmd_function_t *cmd, **prev;
+	cmd_function_t *cmd;
 
 	// execute the command line
 	Cmd_TokenizeString(text);
@@ -1017,29 +1028,13 @@ void Cmd_ExecuteString(const char *text)
 	}
 
 	// check registered command functions
-	for (prev = &cmd_functions ; *prev ; prev = &cmd->next)
+	cmd = Cmd_FindCommand(cmd_argv[0]);
+
+	// perform the action, commands without a function are handled by the cgame or game
+	if (cmd && cmd->function)
 	{
-		cmd = *prev;
-		if (!Q_stricmp(cmd_argv[0], cmd->name))
-		{
-			// rearrange the links so that the command will be
-			// near the head of the list next time it is used
-			*prev         = cmd->next;
-			cmd->next     = cmd_functions;
-			cmd_functions = cmd;
-
-			// perform the action
-			if (!cmd->function)
-			{
-				// let the cgame or game handle it
-				break;
-			}
-			else
-			{
-				cmd->function();
-			}
-			return;
-		}
+		cmd->function();
+		return;
 	}
 
 	// check cvars
@@ -1108,6 +1103,81 @@ void Cmd_List_f(void)
 	Com_Printf("%i commands\n", i);
 }
 
+#ifdef ETLEGACY_DEBUG
+/**
+ * @brief Reference lookup walking the whole command list, as done before the hash table
+ * @param[in] cmd_name
+ * @return
+ */
+static cmd_function_t *Cmd_FindCommandLinear(const char *cmd_name)
+{
+	cmd_function_t *cmd;
+
+	for (cmd = cmd_functions; cmd; cmd = cmd->next)
+	{
+		if (!Q_stricmp(cmd_name, cmd->name))
+		{
+			return cmd;
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Times command lookups over all registered commands plus typical config
+ * lines which aren't commands (cvars, game commands) and have to miss the table
+ */
+static void Cmd_Benchmark_f(void)
+{
+	static const char *misses[] = { "cg_fov", "sensitivity", "name", "rate", "snaps", "com_maxfps", "r_gamma", "cl_maxpackets", "say_team", "ws", "callvote", "fireteam" };
+	cmd_function_t    *cmd;
+	int               iterations = 1000;
+	int               i, j, lookups = 0, hashedHits = 0, linearHits = 0;
+	int64_t           start, hashed, linear;
+
+	if (Cmd_Argc() > 1)
+	{
+		iterations = MAX(Q_atoi(Cmd_Argv(1)), 1);
+	}
+
+	start = Sys_Microseconds();
+	for (i = 0; i < iterations; i++)
+	{
+		for (cmd = cmd_functions; cmd; cmd = cmd->next, lookups++)
+		{
+			hashedHits += Cmd_FindCommand(cmd->name) != NULL;
+		}
+		for (j = 0; j < ARRAY_LEN(misses); j++, lookups++)
+		{
+			hashedHits += Cmd_FindCommand(misses[j]) != NULL;
+		}
+	}
+	hashed = Sys_Microseconds() - start;
+
+	start = Sys_Microseconds();
+	for (i = 0; i < iterations; i++)
+	{
+		for (cmd = cmd_functions; cmd; cmd = cmd->next)
+		{
+			linearHits += Cmd_FindCommandLinear(cmd->name) != NULL;
+		}
+		for (j = 0; j < ARRAY_LEN(misses); j++)
+		{
+			linearHits += Cmd_FindCommandLinear(misses[j]) != NULL;
+		}
+	}
+	linear = Sys_Microseconds() - start;
+
+	Com_Printf("%i lookups: hashed %.3f ns/lookup (%i hits), linear %.3f ns/lookup (%i hits)\n", lookups,
+	           hashed * 1000.0 / lookups, hashedHits, linear * 1000.0 / lookups, linearHits);
+
+	if (hashedHits != linearHits)
+	{
+		Com_Printf(S_COLOR_YELLOW "WARNING: hashed and linear lookups disagree\n");
+	}
+}
+#endif
+
 /**
  * @brief Cmd_CompleteCfgName
  * @param args - unused
@@ -1133,4 +1203,7 @@ void Cmd_Init(void)
 	Cmd_AddCommand("vstr", Cmd_Vstr_f, "Inserts the current value of a variable as command text.", Cvar_CompleteCvarName);
 	Cmd_AddCommand("echo", Cmd_Echo_f, "Prints quoted text to the console and shows a notification if connected to a server.");
 	Cmd_AddCommand("wait", Cmd_Wait_f, "Causes execution of the remainder of the command buffer to be delayed until next frame.");
+#ifdef ETLEGACY_DEBUG
+	Cmd_AddCommand("cmdbench", Cmd_Benchmark_f, "Measures command lookup times over the registered commands.");
+#endif
 }
@@ -96,6 +96,7 @@ jmp_buf abortframe;     // an ERR_DROP occured, exit the entire frame
 void CL_ShutdownCGame(void);
 
 static fileHandle_t logfile;
+static qboolean     logfileDirty;           // unflushed writes with logfile 3
 fileHandle_t        com_journalFile;        // events are written here
 fileHandle_t        com_journalDataFile;    // config files are written here
 
@@ -121,7 +122,7 @@ cvar_t *com_maxfpsMinimized;
 cvar_t *com_timedemo;
 cvar_t *com_sv_running;
 cvar_t *com_cl_running;
-cvar_t *com_logfile;        // 1 = buffer log, 2 = flush after each print
+cvar_t *com_logfile;        // 1 = buffer log, 2 = flush after each print, 3 = flush every frame
 cvar_t *com_showtrace;
 cvar_t *com_version;
 cvar_t *com_buildScript;    // for automated data building scripts
@@ -307,7 +308,7 @@ void QDECL Com_Printf(const char *fmt, ...)
 				strftime(timeFt, sizeof(timeFt), "%a %b %d %X %Y", localtime(&aclock));
 				Com_Printf("logfile opened on %s\n", timeFt);
 
-				if (com_logfile->integer > 1)
+				if (com_logfile->integer == 2)
 				{
 					// force it to not buffer so we get valid
 					// data even if we are crashing
@@ -326,6 +327,12 @@ void QDECL Com_Printf(const char *fmt, ...)
 		if (logfile && FS_Initialized())
 		{
 			FS_Write(msg, strlen(msg), logfile);
+
+			// logfile 3 is flushed once per frame and on errors, see Com_FlushLogfile
+			if (com_logfile->integer > 2)
+			{
+				logfileDirty = qtrue;
+			}
 		}
 	}
 
@@ -355,6 +362,21 @@ void QDECL Com_DPrintf(const char *fmt, ...)
 	Com_Printf("%s", msg);
 }
 
+/**
+ * @brief Push the buffered console log lines to disk
+ *
+ * With logfile 3 this runs at the end of every frame, and it is called on
+ * errors and signals so we get valid data even if we are crashing.
+ */
+void Com_FlushLogfile(void)
+{
+	if (logfile && logfileDirty && FS_Initialized())
+	{
+		FS_Flush(logfile);
+	}
+	logfileDirty = qfalse;
+}
+
 /**
  * @brief Both client and server can use this, and it will do the appropriate thing.
  *
@@ -427,6 +449,7 @@ void QDECL Com_Error(int code, const char *fmt, ...)
 	else if (code == ERR_DROP || code == ERR_DISCONNECT)
 	{
 		Com_Printf("********************\nERROR: %s\n********************\n", com_errorMessage);
+		Com_FlushLogfile();
 		SV_Shutdown(va("Server crashed: %s", com_errorMessage));
 		CL_Disconnect(qtrue);
 		CL_FlushMemory();
@@ -974,6 +997,10 @@ int Com_RealTime(qtime_t *qtime)
 There is never any space between memblocks, and there will never be two
 contiguous free memblocks.
 
+Free memblocks are also linked into one of ZONE_FREELISTS lists by the
+power of two of their size, so an allocation only looks at free blocks
+of a fitting size class instead of walking the whole zone.
+
 The rover can be left pointing at a non-empty block
 
 The zone calls are pretty much only used for small strings and structures,
@@ -982,7 +1009,7 @@ all big things are allocated on the hunk.
 */
 
 #define ZONEID  0x1d4a11
-#define MINFRAGMENT 64
+#define ZONE_FREELISTS 32
 
 /**
  * @struct zonedebug_s
@@ -1009,6 +1036,21 @@ typedef struct memblock_s
 #endif
 } memblock_t;
 
+/**
+ * @struct freeblock_s
+ * @brief Free list links, stored in the data area of a free memblock
+ */
+typedef struct freeblock_s
+{
+	struct freeblock_s *prev, *next;
+} freeblock_t;
+
+#define FREEBLOCK(block)    ((freeblock_t *)((memblock_t *)(block) + 1))
+#define FREEBLOCK_HDR(free) ((memblock_t *)(free) - 1)
+
+/// smallest tail worth splitting off, it must hold a header and the free list links
+#define MINFRAGMENT MAX(64, sizeof(memblock_t) + sizeof(freeblock_t))
+
 /**
  * @struct memzone_s
  */
@@ -1017,7 +1059,9 @@ typedef struct
 	int size;               ///< total bytes malloced, including header
 	int used;               ///< total bytes used
 	memblock_t blocklist;   ///< start / end cap for linked list
-	memblock_t *rover;
+	memblock_t *rover;      ///< last freed block, Z_FreeTags walks the list with it
+	freeblock_t *freelist[ZONE_FREELISTS];  ///< free blocks by power of two size class
+	unsigned int freemask;  ///< bit set for each non-empty free list
 } memzone_t;
 
 /// main zone for all "dynamic" memory allocation
@@ -1030,6 +1074,71 @@ static memzone_t *tvzone;
 
 static void Z_CheckHeap(void);
 
+/**
+ * @brief Size class of a block, the power of two of its size
+ * @param[in] size
+ * @return
+ */
+static ID_INLINE int Z_FreeListForSize(size_t size)
+{
+	int list = 0;
+
+	while (size > 1 && list < ZONE_FREELISTS - 1)
+	{
+		size >>= 1;
+		list++;
+	}
+	return list;
+}
+
+/**
+ * @brief Put a free block on the free list of its size class
+ * @param[in,out] zone
+ * @param[in] block
+ */
+static void Z_LinkFreeBlock(memzone_t *zone, memblock_t *block)
+{
+	int         list = Z_FreeListForSize(block->size);
+	freeblock_t *fb  = FREEBLOCK(block);
+
+	fb->prev = NULL;
+	fb->next = zone->freelist[list];
+	if (fb->next)
+	{
+		fb->next->prev = fb;
+	}
+	zone->freelist[list] = fb;
+	zone->freemask      |= 1u << list;
+}
+
+/**
+ * @brief Take a free block off its free list, before it is used or resized
+ * @param[in,out] zone
+ * @param[in] block
+ */
+static void Z_UnlinkFreeBlock(memzone_t *zone, memblock_t *block)
+{
+	int         list = Z_FreeListForSize(block->size);
+	freeblock_t *fb  = FREEBLOCK(block);
+
+	if (fb->prev)
+	{
+		fb->prev->next = fb->next;
+	}
+	else
+	{
+		zone->freelist[list] = fb->next;
+		if (!fb->next)
+		{
+			zone->freemask &= ~(1u << list);
+		}
+	}
+	if (fb->next)
+	{
+		fb->next->prev = fb->prev;
+	}
+}
+
 /**
  * @brief Z_ClearZone
  * @param[out] zone
@@ -1054,6 +1163,10 @@ static void Z_ClearZone(memzone_t *zone, int size)
 	block->tag  = 0;        // free block
 	block->id   = ZONEID;
 	block->size = size - sizeof(memzone_t);
+
+	Com_Memset(zone->freelist, 0, sizeof(zone->freelist));
+	zone->freemask = 0;
+	Z_LinkFreeBlock(zone, block);
 }
 
 /**
@@ -1119,30 +1232,25 @@ void Z_Free(void *ptr)
 	if (!other->tag)
 	{
 		// merge with previous free block
+		Z_UnlinkFreeBlock(zone, other);
 		other->size      += block->size;
 		other->next       = block->next;
 		other->next->prev = other;
-		if (block == zone->rover)
-		{
-			zone->rover = other;
-		}
-		block = other;
+		block             = other;
 	}
 
-	zone->rover = block;
-
 	other = block->next;
 	if (!other->tag)
 	{
 		// merge the next free block onto the end
+		Z_UnlinkFreeBlock(zone, other);
 		block->size      += other->size;
 		block->next       = other->next;
 		block->next->prev = block;
-		if (other == zone->rover)
-		{
-			zone->rover = block;
-		}
 	}
+
+	Z_LinkFreeBlock(zone, block);
+	zone->rover = block;
 }
 
 /**
@@ -1190,9 +1298,11 @@ void *Z_TagMallocDebug(size_t size, int tag, char *label, char *file, int line)
 void *Z_TagMalloc(size_t size, int tag)
 {
 #endif
-	size_t     extra;
-	memblock_t *start, *rover, *new, *base;
-	memzone_t  *zone;
+	size_t      extra;
+	memblock_t  *new, *base;
+	memzone_t   *zone;
+	freeblock_t *fb;
+	int         list;
 
 	if (!tag)
 	{
@@ -1205,19 +1315,32 @@ void *Z_TagMalloc(size_t size, int tag)
 	allocSize = size;
 #endif
 
-	// scan through the block list looking for the first free block
-	// of sufficient size
-
 	size += sizeof(memblock_t);         // account for size of block header
 	size += 4;                          // space for memory trash tester
 	size  = PAD(size, sizeof(intptr_t)); // align to 32/64 bit boundary
+	if (size < sizeof(memblock_t) + sizeof(freeblock_t))
+	{
+		size = sizeof(memblock_t) + sizeof(freeblock_t); // room for the free list links once freed
+	}
 
-	base  = rover = zone->rover;
-	start = base->prev;
+	// look for the first free block of sufficient size in its own size class,
+	// any block of a larger class will do
+	list = Z_FreeListForSize(size);
+	fb   = zone->freelist[list];
+	while (fb && FREEBLOCK_HDR(fb)->size < size)
+	{
+		fb = fb->next;
+	}
 
-	do
+	if (!fb)
 	{
-		if (rover == start)
+		do
+		{
+			list++;
+		}
+		while (list < ZONE_FREELISTS && !(zone->freemask & (1u << list)));
+
+		if (list == ZONE_FREELISTS)
 		{
 			char *zoneName;
 
@@ -1239,20 +1362,15 @@ void *Z_TagMalloc(size_t size, int tag)
 #endif
 			return NULL;
 		}
-		if (rover->tag)
-		{
-			base = rover = rover->next;
-		}
-		else
-		{
-			rover = rover->next;
-		}
+		fb = zone->freelist[list];
 	}
-	while (base->tag || base->size < size);
 
 	// found a block big enough
+	base = FREEBLOCK_HDR(fb);
+	Z_UnlinkFreeBlock(zone, base);
+
 	extra = base->size - size;
-	if (extra > MINFRAGMENT)
+	if (extra >= MINFRAGMENT)
 	{
 		// there will be a free fragment after the allocated block
 		new             = ( memblock_t * )((byte *)base + size);
@@ -1264,12 +1382,12 @@ void *Z_TagMalloc(size_t size, int tag)
 		new->next->prev = new;
 		base->next      = new;
 		base->size      = size;
+		Z_LinkFreeBlock(zone, new);
 	}
 
 	base->tag = tag;            // no longer a free block
 
-	zone->rover = base->next;   // next allocation will start looking here
-	zone->used += base->size;   //
+	zone->used += base->size;
 
 	base->id = ZONEID;
 
@@ -1584,7 +1702,9 @@ void Com_Meminfo_f(void)
 {
 	memblock_t *block;
 	int        zoneBytes = 0, zoneBlocks = 0;
+	int        zoneFreeBytes = 0, zoneFreeBlocks = 0, zoneLargestFree = 0;
 	int        smallZoneBytes, smallZoneBlocks;
+	int        smallZoneFreeBytes = 0, smallZoneFreeBlocks = 0, smallZoneLargestFree = 0;
 	int        botlibBytes = 0, rendererBytes = 0;
 	int        tvZoneBytes = 0, tvZoneBlocks = 0;
 	int        unused;
@@ -1609,6 +1729,15 @@ void Com_Meminfo_f(void)
 				rendererBytes += block->size;
 			}
 		}
+		else
+		{
+			zoneFreeBytes += block->size;
+			zoneFreeBlocks++;
+			if (block->size > zoneLargestFree)
+			{
+				zoneLargestFree = block->size;
+			}
+		}
 
 		if (block->next == &mainzone->blocklist)
 		{
@@ -1637,6 +1766,15 @@ void Com_Meminfo_f(void)
 			smallZoneBytes += block->size;
 			smallZoneBlocks++;
 		}
+		else
+		{
+			smallZoneFreeBytes += block->size;
+			smallZoneFreeBlocks++;
+			if (block->size > smallZoneLargestFree)
+			{
+				smallZoneLargestFree = block->size;
+			}
+		}
 
 		if (block->next == &smallzone->blocklist)
 		{
@@ -1702,9 +1840,11 @@ void Com_Meminfo_f(void)
 	Com_Printf("        %9i bytes (%6.2f MB) in dynamic botlib\n", botlibBytes, botlibBytes / Square(1024.f));
 	Com_Printf("        %9i bytes (%6.2f MB) in dynamic renderer\n", rendererBytes, rendererBytes / Square(1024.f));
 	Com_Printf("        %9i bytes (%6.2f MB) in dynamic other\n", zoneBytes - (botlibBytes + rendererBytes), (zoneBytes - (botlibBytes + rendererBytes)) / Square(1024.f));
+	Com_Printf("%9i bytes (%6.2f MB) free in %i zone fragments, largest %i bytes\n", zoneFreeBytes, zoneFreeBytes / Square(1024.f), zoneFreeBlocks, zoneLargestFree);
 	Com_Printf("\n");
 
 	Com_Printf("%9i bytes (%6.2f MB) in small Zone memory (%i) blocks\n", smallZoneBytes, smallZoneBytes / Square(1024.f), smallZoneBlocks);
+	Com_Printf("%9i bytes (%6.2f MB) free in %i small zone fragments, largest %i bytes\n", smallZoneFreeBytes, smallZoneFreeBytes / Square(1024.f), smallZoneFreeBlocks, smallZoneLargestFree);
 	if (tvzone)
 	{
 		Com_Printf("%9i bytes (%6.2f MB) in tv Zone memory (%i) blocks\n", tvZoneBytes, tvZoneBytes / Square(1024.f), tvZoneBlocks);
@@ -3766,6 +3906,8 @@ void Com_Frame(void)
 		c_pointcontents = 0;
 	}
 
+	Com_FlushLogfile();
+
 	com_frameNumber++;
 }
 
@@ -3835,7 +3977,8 @@ void Com_Shutdown(qboolean badProfile)
 	if (logfile)
 	{
 		FS_FCloseFile(logfile);
-		logfile = 0;
+		logfile      = 0;
+		logfileDirty = qfalse;
 	}
 
 	if (com_journalFile)
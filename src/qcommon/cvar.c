@@ -40,7 +40,7 @@ cvar_t      *cvar_vars;
 cvar_t      *cvar_cheats;
 cvarFlags_t cvar_modifiedFlags;
 
-#define MAX_CVARS   2048
+#define MAX_CVARS   MAX_CVAR_HANDLES
 cvar_t cvar_indexes[MAX_CVARS];
 int    cvar_numIndexes;
 
@@ -48,6 +48,43 @@ int    cvar_numIndexes;
 static cvar_t *hashTable[FILE_HASH_SIZE];
 #define generateHashValue(fname) Q_GenerateHashValue(fname, FILE_HASH_SIZE, qtrue, qtrue)
 
+/**
+ * @struct cvarJournalData_t
+ * @brief Handles of the cvars modified since the owning module last read its journal,
+ * each handle is listed at most once so the list can't overflow
+ */
+typedef struct
+{
+	qboolean active;
+	int numHandles;
+	int handles[MAX_CVARS];
+	int pending[MAX_CVARS / 32];
+} cvarJournalData_t;
+
+static cvarJournalData_t cvar_journals[CVAR_JOURNAL_MAX];
+
+/**
+ * @brief Queues a modified cvar in every active journal which doesn't list it yet
+ * @param[in] var
+ */
+static void Cvar_JournalTouch(const cvar_t *var)
+{
+	int               handle = var - cvar_indexes;
+	int               i;
+	cvarJournalData_t *journal;
+
+	for (i = 0, journal = cvar_journals; i < CVAR_JOURNAL_MAX; i++, journal++)
+	{
+		if (!journal->active || COM_BitCheck(journal->pending, handle))
+		{
+			continue;
+		}
+
+		COM_BitSet(journal->pending, handle);
+		journal->handles[journal->numHandles++] = handle;
+	}
+}
+
 /**
  * @brief Cvar_ValidateString
  * @param[in] s
@@ -635,6 +672,9 @@ cvar_t *Cvar_Get(const char *varName, const char *value, cvarFlags_t flags)
 	var->hashPrev   = NULL;
 	hashTable[hash] = var;
 
+	// the slot might have been in use by an unset cvar a module still holds a handle of
+	Cvar_JournalTouch(var);
+
 	return var;
 }
 
@@ -794,6 +834,7 @@ cvar_t *Cvar_Set2(const char *var_name, const char *value, qboolean force)
 			var->latchedString = CopyString(value);
 			var->modified      = qtrue;
 			var->modificationCount++;
+			Cvar_JournalTouch(var);
 			return var;
 		}
 	}
@@ -813,6 +854,7 @@ cvar_t *Cvar_Set2(const char *var_name, const char *value, qboolean force)
 	}
 	var->modified = qtrue;
 	var->modificationCount++;
+	Cvar_JournalTouch(var);
 
 	Z_Free(var->string);     // free the old value string
 
@@ -1938,6 +1980,54 @@ void Cvar_Update(vmCvar_t *vmCvar)
 	vmCvar->integer = cv->integer;
 }
 
+/**
+ * @brief Starts a fresh cvar journal for a module, called before the module registers its cvars
+ * @param[in] journal
+ */
+void Cvar_JournalReset(cvarJournal_t journal)
+{
+	cvarJournalData_t *data = &cvar_journals[journal];
+
+	Com_Memset(data->pending, 0, sizeof(data->pending));
+	data->numHandles = 0;
+	data->active     = qtrue;
+}
+
+/**
+ * @brief Hands out the handles of all cvars modified since the last read of a journal.
+ * Modules call this once per frame instead of polling every registered cvar with Cvar_Update.
+ * @param[in] journal
+ * @param[out] handles
+ * @param[in] maxHandles
+ * @return number of handles written, handles which didn't fit stay queued for the next read
+ */
+int Cvar_JournalRead(cvarJournal_t journal, int *handles, int maxHandles)
+{
+	cvarJournalData_t *data = &cvar_journals[journal];
+	int               count, i;
+
+	if (!handles || maxHandles <= 0)
+	{
+		return 0;
+	}
+
+	count = MIN(data->numHandles, maxHandles);
+
+	for (i = 0; i < count; i++)
+	{
+		handles[i] = data->handles[i];
+		COM_BitClear(data->pending, data->handles[i]);
+	}
+
+	data->numHandles -= count;
+	if (data->numHandles)
+	{
+		memmove(data->handles, data->handles + count, data->numHandles * sizeof(data->handles[0]));
+	}
+
+	return count;
+}
+
 /**
  * @brief Cvar_CompleteCvarName
  * @param[in] args
@@ -1251,6 +1251,7 @@ void MSG_WriteDeltaEntity(msg_t *msg, entityState_t *from, entityState_t *to, qb
 	int        trunc;
 	float      fullFloat;
 	int        *fromF, *toF;
+	byte       changed[ARRAY_LEN(entityStateFields)];
 
 	// all fields should be 32 bits to avoid any compiler packing issues
 	// the "number" field is not part of the field list
@@ -1280,16 +1281,26 @@ void MSG_WriteDeltaEntity(msg_t *msg, entityState_t *from, entityState_t *to, qb
 	}
 
 	lc = 0;
-	// build the change vector as bytes so it is endien independent
-	for (i = 0, field = entityStateFields ; i < numFields ; i++, field++)
+	// most entities don't change between snapshots, a single compare of the
+	// whole state is much cheaper than checking the fields one by one
+	if (memcmp(from, to, sizeof(*to)))
 	{
-		fromF = ( int * )((byte *)from + field->offset);
-		toF   = ( int * )((byte *)to + field->offset);
-		if (*fromF != *toF)
+		// build the change vector as bytes so it is endien independent
+		for (i = 0, field = entityStateFields ; i < numFields ; i++, field++)
 		{
-			lc = i + 1;
+			fromF = ( int * )((byte *)from + field->offset);
+			toF   = ( int * )((byte *)to + field->offset);
+			if (*fromF != *toF)
+			{
+				lc         = i + 1;
+				changed[i] = qtrue;
 
-			field->used++;
+				field->used++;
+			}
+			else
+			{
+				changed[i] = qfalse;
+			}
 		}
 	}
 
@@ -1319,10 +1330,7 @@ void MSG_WriteDeltaEntity(msg_t *msg, entityState_t *from, entityState_t *to, qb
 
 	for (i = 0, field = entityStateFields ; i < lc ; i++, field++)
 	{
-		fromF = ( int * )((byte *)from + field->offset);
-		toF   = ( int * )((byte *)to + field->offset);
-
-		if (*fromF == *toF)
+		if (!changed[i])
 		{
 			MSG_WriteBits(msg, 0, 1);   // no change
 
@@ -1331,6 +1339,8 @@ void MSG_WriteDeltaEntity(msg_t *msg, entityState_t *from, entityState_t *to, qb
 			continue;
 		}
 
+		toF = ( int * )((byte *)to + field->offset);
+
 		MSG_WriteBits(msg, 1, 1);   // changed
 
 		if (field->bits == 0)
@@ -2249,6 +2259,7 @@ void MSG_WriteDeltaPlayerstate(msg_t *msg, struct playerState_s *from, struct pl
 	int           trunc;
 	int           startBit, endBit;
 	int           print;
+	byte          changed[ARRAY_LEN(playerStateFields)];
 
 	if (!from)
 	{
@@ -2286,10 +2297,15 @@ void MSG_WriteDeltaPlayerstate(msg_t *msg, struct playerState_s *from, struct pl
 		toF   = ( int * )((byte *)to + field->offset);
 		if (*fromF != *toF)
 		{
-			lc = i + 1;
+			lc         = i + 1;
+			changed[i] = qtrue;
 
 			field->used++;
 		}
+		else
+		{
+			changed[i] = qfalse;
+		}
 	}
 
 	MSG_WriteByte(msg, lc);     // # of changes
@@ -2298,10 +2314,7 @@ void MSG_WriteDeltaPlayerstate(msg_t *msg, struct playerState_s *from, struct pl
 
 	for (i = 0, field = playerStateFields ; i < lc ; i++, field++)
 	{
-		fromF = ( int * )((byte *)from + field->offset);
-		toF   = ( int * )((byte *)to + field->offset);
-
-		if (*fromF == *toF)
+		if (!changed[i])
 		{
 			wastedbits++;
 
@@ -2309,6 +2322,8 @@ void MSG_WriteDeltaPlayerstate(msg_t *msg, struct playerState_s *from, struct pl
 			continue;
 		}
 
+		toF = ( int * )((byte *)to + field->offset);
+
 		MSG_WriteBits(msg, 1, 1);   // changed
 		//pcount[i]++;
 
@@ -212,7 +212,8 @@ int Q_RandomInt(int *seed)
 float Q_RandomFloat(int *seed)
 {
 	*seed = Q_LCG(*seed);
-	return (float)(*seed & 0xffff) / (float)0x10000;
+	// the low bits of the LCG repeat after a few thousand numbers, use the high ones
+	return (float)((*seed >> 15) & 0xffff) / (float)0x10000;
 }
 
 //=======================================================
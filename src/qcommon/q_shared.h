@@ -1096,6 +1096,8 @@ typedef struct cvar_s
 
 #define MAX_CVAR_VALUE_STRING   256
 
+#define MAX_CVAR_HANDLES        2048    ///< cvar handles are indexes below this, sizes the per module cvar journal bit sets
+
 typedef int cvarHandle_t;
 
 /**
@@ -699,6 +699,24 @@ void Cvar_Register(vmCvar_t *vmCvar, const char *varName, const char *defaultVal
 void Cvar_Update(vmCvar_t *vmCvar);
 // updates an interpreted modules' version of a cvar
 
+/**
+ * @enum cvarJournal_t
+ * @brief Modules which keep a journal of modified cvar handles
+ */
+typedef enum
+{
+	CVAR_JOURNAL_GAME = 0,
+	CVAR_JOURNAL_CGAME,
+	CVAR_JOURNAL_UI,
+	CVAR_JOURNAL_MAX
+} cvarJournal_t;
+
+void Cvar_JournalReset(cvarJournal_t journal);
+// starts recording cvar modifications for a module, drops anything pending
+
+int Cvar_JournalRead(cvarJournal_t journal, int *handles, int maxHandles);
+// hands out the handles of cvars modified since the last read, returns the count
+
 void Cvar_Set(const char *varName, const char *value);
 // will create the variable with no flags if it doesn't exist
 
@@ -1052,6 +1070,7 @@ void Com_BeginRedirect(char *buffer, size_t buffersize, void (*flush)(char *));
 void Com_EndRedirect(void);
 void QDECL Com_Printf(const char *fmt, ...) _attribute((format(printf, 1, 2)));
 void QDECL Com_DPrintf(const char *fmt, ...) _attribute((format(printf, 1, 2)));
+void Com_FlushLogfile(void);
 NORETURN_MSVC void QDECL Com_Error(int code, const char *fmt, ...) _attribute((noreturn, format(printf, 2, 3)));
 NORETURN_MSVC void Com_Quit_f(void) _attribute((noreturn));
 
@@ -40,6 +40,9 @@
  */
 
 #include "tr_local.h"
+#ifdef ETL_SSE
+#include <immintrin.h>
+#endif
 
 // undef to use floating-point lerping with explicit trig funcs
 #define YD_INGLES
@@ -83,6 +86,9 @@ static qboolean                 isTorso, fullTorso;
 static vec4_t                   m1[4], m2[4];
 static vec3_t                   t;
 static refEntity_t              lastBoneEntity;
+#ifdef ETL_SSE
+static vec4_t                   boneColumns[MDX_MAX_BONES][4] QALIGN(16); ///< matrix columns and translation of the bones, for SSE skinning
+#endif
 
 static int totalrv, totalrt, totalv, totalt;
 
@@ -1858,6 +1864,56 @@ void RB_MDM_SurfaceAnim(mdmSurface_t *surface)
 	v          = ( mdmVertex_t * )((byte *)surface + surface->ofsVerts);
 	tempVert   = ( float * )(tess.xyz + baseVertex);
 	tempNormal = ( float * )(tess.normal + baseVertex);
+#ifdef ETL_SSE
+	// transpose the referenced bones once so each weight is a few vector ops,
+	// the operations are done in the same order as the scalar path below
+	boneRefs = boneList;
+	for (j = 0; j < surface->numBoneReferences; j++, boneRefs++)
+	{
+		bone = &bones[*boneRefs];
+		for (k = 0; k < 3; k++)
+		{
+			boneColumns[*boneRefs][k][0] = bone->matrix[0][k];
+			boneColumns[*boneRefs][k][1] = bone->matrix[1][k];
+			boneColumns[*boneRefs][k][2] = bone->matrix[2][k];
+			boneColumns[*boneRefs][k][3] = 0.f;
+		}
+		VectorCopy(bone->translation, boneColumns[*boneRefs][3]);
+		boneColumns[*boneRefs][3][3] = 0.f;
+	}
+
+	for (j = 0; j < render_count; j++, tempVert += 4, tempNormal += 4)
+	{
+		mdmWeight_t *w;
+		vec4_t      *col;
+		__m128      acc, sum;
+
+		acc = _mm_setzero_ps();
+
+		w = v->weights;
+		for (k = 0 ; k < v->numWeights ; k++, w++)
+		{
+			col = boneColumns[w->boneIndex];
+			sum = _mm_mul_ps(_mm_set1_ps(w->offset[0]), _mm_loadu_ps(col[0]));
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(w->offset[1]), _mm_loadu_ps(col[1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(w->offset[2]), _mm_loadu_ps(col[2])));
+			sum = _mm_add_ps(sum, _mm_loadu_ps(col[3]));
+			acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(w->boneWeight), sum));
+		}
+		_mm_storeu_ps(tempVert, acc);
+
+		col = boneColumns[v->weights[0].boneIndex];
+		sum = _mm_mul_ps(_mm_set1_ps(v->normal[0]), _mm_loadu_ps(col[0]));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(v->normal[1]), _mm_loadu_ps(col[1])));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(v->normal[2]), _mm_loadu_ps(col[2])));
+		_mm_storeu_ps(tempNormal, sum);
+
+		tess.texCoords[baseVertex + j][0][0] = v->texCoords[0];
+		tess.texCoords[baseVertex + j][0][1] = v->texCoords[1];
+
+		v = (mdmVertex_t *)&v->weights[v->numWeights];
+	}
+#else
 	for (j = 0; j < render_count; j++, tempVert += 4, tempNormal += 4)
 	{
 		mdmWeight_t *w;
@@ -1878,6 +1934,7 @@ void RB_MDM_SurfaceAnim(mdmSurface_t *surface)
 
 		v = (mdmVertex_t *)&v->weights[v->numWeights];
 	}
+#endif
 
 	DBG_SHOWTIME
 
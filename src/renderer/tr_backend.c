@@ -35,6 +35,8 @@
 #include "tr_local.h"
 
 backEndData_t  *backEndData;
+backEndData_t  *backEndFrames[SMP_FRAMES];   ///< backEndData points to the one the front end fills
+int            numBackEndFrames;
 backEndState_t backEnd;
 
 /**
@@ -158,6 +158,8 @@ cvar_t *r_maxPolyVerts;
 
 cvar_t *r_gfxInfo;
 
+cvar_t *r_backEndFrames;
+
 cvar_t *r_scale;
 
 /**
@@ -343,6 +345,10 @@ void R_Register(void)
 	r_maxPolyVerts = ri.Cvar_Get("r_maxpolyverts", va("%d", DEFAULT_POLYVERTS), CVAR_LATCH); // now latched to check against used r_maxpolyverts and not MAX_POLYVERTS
 	ri.Cvar_CheckRange(r_maxPolyVerts, MIN_POLYVERTS, MAX_POLYVERTS, qtrue);            // MIN_POLYVERTS was old static value
 
+	// 2 keeps the commands and scene data of the last frame intact while the next one is built
+	r_backEndFrames = ri.Cvar_Get("r_backEndFrames", "1", CVAR_LATCH);
+	ri.Cvar_CheckRange(r_backEndFrames, 1, SMP_FRAMES, qtrue);
+
 	r_gfxInfo = ri.Cvar_Get("r_gfxinfo", "0", 0); // less spammy gfx output at start - enable to print full GL_EXTENSION string
 
 	r_scale = ri.Cvar_Get("r_scale", "1", CVAR_ARCHIVE | CVAR_LATCH);
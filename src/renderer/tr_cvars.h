@@ -74,6 +74,8 @@ extern cvar_t *r_wolfFog;
 
 extern cvar_t *r_gfxInfo;
 
+extern cvar_t *r_backEndFrames;
+
 extern cvar_t *r_scale;
 
 extern cvar_t *r_screenshotFormat;
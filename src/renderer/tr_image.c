@@ -1030,31 +1030,34 @@ void R_LoadImage(const char *name, byte **pic, int *width, int *height)
 	// Searching is done in this order: tga, jp(e)g, png, pcx, bmp
 	for (i = 0; i < numImageLoaders; i++)
 	{
-		altName = va("%s.%s", localName, imageLoaders[i].ext);
+		imageData_t data = { 0, NULL, { NULL } };
 
-		// Check if file exists
-		if (ri.FS_FOpenFileRead(altName, NULL, qfalse) > 0)
+		altName   = va("%s.%s", localName, imageLoaders[i].ext);
+		data.name = altName;
+
+		// load the file straight away, checking if it exists first
+		// means walking all the search paths twice for every image
+		data.size = ri.FS_ReadFile(altName, &data.buffer.v);
+		if (!data.buffer.b || data.size <= 0)
 		{
-			imageData_t data = { 0, altName, { NULL } };
-			// load the file
-			data.size = ri.FS_ReadFile(altName, &data.buffer.v);
-			if (!data.buffer.b || data.size < 0)
+			// not present in this format
+			if (data.buffer.b)
 			{
-				Ren_Developer("Failed to load an image (%s)\n", data.name);
-				continue;
+				ri.FS_FreeFile(data.buffer.v);
 			}
+			continue;
+		}
 
-			// Load
-			loaderRet = imageLoaders[i].ImageLoader(&data, pic, width, height, 0xFF);
+		// Load
+		loaderRet = imageLoaders[i].ImageLoader(&data, pic, width, height, 0xFF);
 
-			// free the file data
-			ri.FS_FreeFile(data.buffer.v);
+		// free the file data
+		ri.FS_FreeFile(data.buffer.v);
 
-			if (!loaderRet)
-			{
-				Ren_Developer("Image loader failed to parse an image %s\n", data.name);
-				*pic = NULL;
-			}
+		if (!loaderRet)
+		{
+			Ren_Developer("Image loader failed to parse an image %s\n", data.name);
+			*pic = NULL;
 		}
 
 		if (*pic)
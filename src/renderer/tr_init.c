@@ -554,7 +554,8 @@ const void *RB_TakeVideoFrameCmd(const void *data)
 
 	tmpFbo = R_CurrentFBO();
 	R_BindFBO(NULL);
-	glReadPixels(0, 0, cmd->width, cmd->height, GL_RGB, GL_UNSIGNED_BYTE, cBuf);
+	// AVI wants BGR, let the driver do the swap for raw frames
+	glReadPixels(0, 0, cmd->width, cmd->height, cmd->motionJpeg ? GL_RGB : GL_BGR, GL_UNSIGNED_BYTE, cBuf);
 	R_BindFBO(tmpFbo);
 
 	memcount = padwidth * cmd->height;
@@ -572,26 +573,36 @@ const void *RB_TakeVideoFrameCmd(const void *data)
 		                              cmd->width, cmd->height, cBuf, padlen);
 		ri.CL_WriteAVIVideoFrame(cmd->encodeBuffer, memcount);
 	}
+	else if (padwidth == avipadwidth)
+	{
+		byte *srcptr, *memend;
+
+		// same line layout as the AVI, only clear the paddings and write the frame as it is
+		if (avipadlen)
+		{
+			for (srcptr = cBuf + linelen, memend = cBuf + memcount; srcptr < memend; srcptr += padwidth)
+			{
+				Com_Memset(srcptr, '\0', avipadlen);
+			}
+		}
+
+		ri.CL_WriteAVIVideoFrame(cBuf, avipadwidth * cmd->height);
+	}
 	else
 	{
-		byte *lineend, *memend;
+		byte *memend;
 		byte *srcptr, *destptr;
 
 		srcptr  = cBuf;
 		destptr = cmd->encodeBuffer;
 		memend  = srcptr + memcount;
 
-		// swap R and B and remove line paddings
+		// remove line paddings
 		while (srcptr < memend)
 		{
-			lineend = srcptr + linelen;
-			while (srcptr < lineend)
-			{
-				*destptr++ = srcptr[2];
-				*destptr++ = srcptr[1];
-				*destptr++ = srcptr[0];
-				srcptr    += 3;
-			}
+			Com_Memcpy(destptr, srcptr, linelen);
+			destptr += linelen;
+			srcptr  += linelen;
 
 			Com_Memset(destptr, '\0', avipadlen);
 			destptr += avipadlen;
@@ -969,11 +980,17 @@ void R_Init(void)
 
 	R_Register();
 
-	ptr = ri.Hunk_Alloc(sizeof(*backEndData) + sizeof(srfPoly_t) * r_maxPolys->integer + sizeof(polyVert_t) * r_maxPolyVerts->integer, h_low);
+	numBackEndFrames = r_backEndFrames->integer;
+	for (i = 0; i < numBackEndFrames; i++)
+	{
+		ptr = ri.Hunk_Alloc(sizeof(*backEndData) + sizeof(srfPoly_t) * r_maxPolys->integer + sizeof(polyVert_t) * r_maxPolyVerts->integer, h_low);
+
+		backEndData            = (backEndData_t *) ptr;
+		backEndData->polys     = (srfPoly_t *) ((char *) ptr + sizeof(*backEndData));
+		backEndData->polyVerts = (polyVert_t *) ((char *) ptr + sizeof(*backEndData) + sizeof(srfPoly_t) * r_maxPolys->integer);
 
-	backEndData            = (backEndData_t *) ptr;
-	backEndData->polys     = (srfPoly_t *) ((char *) ptr + sizeof(*backEndData));
-	backEndData->polyVerts = (polyVert_t *) ((char *) ptr + sizeof(*backEndData) + sizeof(srfPoly_t) * r_maxPolys->integer);
+		backEndFrames[i] = backEndData;
+	}
 
 	R_InitNextFrame();
 
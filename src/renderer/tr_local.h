@@ -2115,7 +2115,11 @@ typedef struct
 	renderCommandList_t commands;
 } backEndData_t;
 
+#define SMP_FRAMES 2    ///< max backEndData buffers, see r_backEndFrames
+
 extern backEndData_t *backEndData;
+extern backEndData_t *backEndFrames[SMP_FRAMES];
+extern int           numBackEndFrames;
 
 void *R_GetCommandBuffer(int bytes);
 void RB_ExecuteRenderCommands(const void *data);
@@ -61,11 +61,20 @@ int r_firstSceneDecal;
 
 int skyboxportal;
 
+static int smpFrame;
+
 /**
  * @brief R_InitNextFrame
  */
 void R_InitNextFrame(void)
 {
+	// flip to the other buffers, the last frame's commands and scene data stay untouched
+	if (numBackEndFrames > 1)
+	{
+		smpFrame    = (smpFrame + 1) % numBackEndFrames;
+		backEndData = backEndFrames[smpFrame];
+	}
+
 	backEndData->commands.used = 0;
 
 	r_firstSceneDrawSurf = 0;
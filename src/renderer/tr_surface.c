@@ -45,6 +45,9 @@
 #if idppc_altivec && !defined(__APPLE__)
 #include <altivec.h>
 #endif
+#ifdef ETL_SSE
+#include <immintrin.h>
+#endif
 
 /**
  * @brief RB_CheckOverflow
@@ -1028,6 +1031,7 @@ static void LerpMeshVertexes_altivec(md3Surface_t *surf, float backlerp)
 }
 #endif
 
+#ifndef ETL_SSE
 /**
  * @brief LerpMeshVertexes_scalar
  * @param[in] surf
@@ -1140,6 +1144,97 @@ static void LerpMeshVertexes_scalar(md3Surface_t *surf, float backlerp)
 		//VectorArrayNormalize((vec4_t *)tess.normal[tess.numVertexes], numVerts);
 	}
 }
+#endif
+
+#ifdef ETL_SSE
+/**
+ * @brief SSE version of LerpMeshVertexes_scalar, the xyz of a vertex is
+ * lerped in one go, normals are still looked up from the sin table
+ * @param[in] surf
+ * @param[in] backlerp
+ *
+ * @note Gives the same xyz as the scalar path, the w component of the output
+ * xyz would get the scaled packed normal and is cleared instead.
+ */
+static void LerpMeshVertexes_sse(md3Surface_t *surf, float backlerp)
+{
+	float    *outXyz    = tess.xyz[tess.numVertexes];
+	float    *outNormal = tess.normal[tess.numVertexes];
+	__m128   newXyzScale, oldXyzScale;
+	__m128   newXyzVec, oldXyzVec;
+	__m128   xyzMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+	__m128i  packed;
+	float    newNormalScale;
+	int      vertNum;
+	unsigned lat, lng;
+	int      numVerts;
+	short    *oldXyz, *newXyz, *oldNormals, *newNormals;
+
+	newXyz     = ( short * )((byte *)surf + surf->ofsXyzNormals) + (backEnd.currentEntity->e.frame * surf->numVerts * 4);
+	newNormals = newXyz + 3;
+
+	newXyzScale    = _mm_set1_ps(MD3_XYZ_SCALE * (1.0 - backlerp));
+	newNormalScale = 1.0f - backlerp;
+
+	numVerts = surf->numVerts;
+
+	if (backlerp == 0.f)
+	{
+		// just copy the vertexes
+		for (vertNum = 0 ; vertNum < numVerts ; vertNum++,
+		     newXyz += 4, newNormals += 4,
+		     outXyz += 4, outNormal += 4)
+		{
+			// sign extend the 4 shorts (xyz + packed normal) to ints
+			packed    = _mm_loadl_epi64((const __m128i *)newXyz);
+			newXyzVec = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+			_mm_storeu_ps(outXyz, _mm_and_ps(_mm_mul_ps(newXyzVec, newXyzScale), xyzMask));
+
+			lat  = (newNormals[0] >> 8) & 0xff;
+			lng  = (newNormals[0] & 0xff);
+			lat *= (FUNCTABLE_SIZE / 256);
+			lng *= (FUNCTABLE_SIZE / 256);
+
+			outNormal[0] = tr.sinTable[(lat + (FUNCTABLE_SIZE / 4)) & FUNCTABLE_MASK] * tr.sinTable[lng];
+			outNormal[1] = tr.sinTable[lat] * tr.sinTable[lng];
+			outNormal[2] = tr.sinTable[(lng + (FUNCTABLE_SIZE / 4)) & FUNCTABLE_MASK];
+		}
+	}
+	else
+	{
+		float oldNormalScale;
+
+		// interpolate and copy the vertex and normal
+		oldXyz = ( short * )((byte *)surf + surf->ofsXyzNormals)
+		         + (backEnd.currentEntity->e.oldframe * surf->numVerts * 4);
+		oldNormals = oldXyz + 3;
+
+		oldXyzScale    = _mm_set1_ps(MD3_XYZ_SCALE * backlerp);
+		oldNormalScale = backlerp;
+
+		for (vertNum = 0 ; vertNum < numVerts ; vertNum++,
+		     oldXyz += 4, newXyz += 4, oldNormals += 4, newNormals += 4,
+		     outXyz += 4, outNormal += 4)
+		{
+			packed    = _mm_loadl_epi64((const __m128i *)oldXyz);
+			oldXyzVec = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+			packed    = _mm_loadl_epi64((const __m128i *)newXyz);
+			newXyzVec = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+			_mm_storeu_ps(outXyz, _mm_and_ps(_mm_add_ps(_mm_mul_ps(oldXyzVec, oldXyzScale), _mm_mul_ps(newXyzVec, newXyzScale)), xyzMask));
+
+			// same lat/long lerp as LerpMeshVertexes_scalar
+			lat = (int)((((oldNormals[0] >> 8) & 0xFF) * (FUNCTABLE_SIZE / 256) * newNormalScale) +
+			            (((oldNormals[0] >> 8) & 0xFF) * (FUNCTABLE_SIZE / 256) * oldNormalScale));
+			lng = (int)(((oldNormals[0] & 0xFF) * (FUNCTABLE_SIZE / 256) * newNormalScale) +
+			            ((oldNormals[0] & 0xFF) * (FUNCTABLE_SIZE / 256) * oldNormalScale));
+
+			outNormal[0] = tr.sinTable[(lat + (FUNCTABLE_SIZE / 4)) & FUNCTABLE_MASK] * tr.sinTable[lng];
+			outNormal[1] = tr.sinTable[lat] * tr.sinTable[lng];
+			outNormal[2] = tr.sinTable[(lng + (FUNCTABLE_SIZE / 4)) & FUNCTABLE_MASK];
+		}
+	}
+}
+#endif
 
 /**
  * @brief LerpMeshVertexes
@@ -1156,7 +1251,11 @@ static void LerpMeshVertexes(md3Surface_t *surf, float backlerp)
 		return;
 	}
 #endif // idppc_altivec
+#ifdef ETL_SSE
+	LerpMeshVertexes_sse(surf, backlerp);
+#else
 	LerpMeshVertexes_scalar(surf, backlerp);
+#endif
 }
 
 /**
@@ -60,7 +60,9 @@ static shader_t *hashTable[FILE_HASH_SIZE];
  */
 typedef struct shaderStringPointer_s
 {
-	char *pStr;
+	char *pStr;                         ///< start of the shader label in s_shaderText
+	char *pText;                        ///< text right after the label, where ParseShader starts
+	int nameLength;                     ///< length of the plain label ending at pText, 0 if it has to be parsed again
 	struct shaderStringPointer_s *next;
 } shaderStringPointer_t;
 
@@ -3136,6 +3138,7 @@ static char *FindShaderInShaderText(const char *shadername)
 		/*if (strstr( shadername, "/" ) && !strstr( shadername, "." ))*/ {
 			unsigned short int    checksum;
 			shaderStringPointer_t *pShaderString;
+			int                   nameLength = (int)strlen(shadername);
 
 			checksum = generateHashValue(shadername);
 
@@ -3143,6 +3146,23 @@ static char *FindShaderInShaderText(const char *shadername)
 			pShaderString = &shaderChecksumLookup[checksum];
 			while (pShaderString && pShaderString->pStr)
 			{
+				// labels are compared in place, no need to run the tokenizer again
+				if (pShaderString->nameLength)
+				{
+					if (pShaderString->nameLength == nameLength
+					    && !Q_stricmpn(pShaderString->pText - nameLength, shadername, nameLength))
+					{
+#ifdef SH_LOADTIMING
+						total += Sys_Milliseconds() - start;
+						Ren_Print("Shader lookup: %i, total: %i\n", Sys_Milliseconds() - start, total);
+#endif // _DEBUG
+						return pShaderString->pText;
+					}
+
+					pShaderString = pShaderString->next;
+					continue;
+				}
+
 				p = pShaderString->pStr;
 
 				token = COM_ParseExt(&p, qtrue);
@@ -3758,6 +3778,7 @@ static void BuildShaderChecksumLookup(void)
 	char               *p = s_shaderText, *pOld;
 	char               *token;
 	unsigned short int checksum;
+	int                nameLength;
 	int                numShaderStringPointers = 0;
 
 	// initialize the checksums
@@ -3782,12 +3803,21 @@ static void BuildShaderChecksumLookup(void)
 		// get it's checksum
 		checksum = generateHashValue(token);
 
+		// plain labels end right where the parser stopped, quoted ones are parsed again on lookup
+		nameLength = (int)strlen(token);
+		if (p - pOld < nameLength || Q_strncmp(p - nameLength, token, nameLength))
+		{
+			nameLength = 0;
+		}
+
 		//Ren_Print("Shader Found: %s\n", token );
 
 		// if it's not currently used
 		if (!shaderChecksumLookup[checksum].pStr)
 		{
-			shaderChecksumLookup[checksum].pStr = pOld;
+			shaderChecksumLookup[checksum].pStr       = pOld;
+			shaderChecksumLookup[checksum].pText      = p;
+			shaderChecksumLookup[checksum].nameLength = nameLength;
 		}
 		else
 		{
@@ -3801,6 +3831,8 @@ static void BuildShaderChecksumLookup(void)
 
 			newStrPtr                           = &shaderStringPointerList[numShaderStringPointers++]; //ri.Hunk_Alloc( sizeof( shaderStringPointer_t ), h_low );
 			newStrPtr->pStr                     = pOld;
+			newStrPtr->pText                    = p;
+			newStrPtr->nameLength               = nameLength;
 			newStrPtr->next                     = shaderChecksumLookup[checksum].next;
 			shaderChecksumLookup[checksum].next = newStrPtr;
 		}
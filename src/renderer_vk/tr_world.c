@@ -570,7 +570,7 @@ static void R_RecursiveWorldNode(mnode_t *node, int planeBits, int dlightBits, i
 				}
 				if (r == 1)
 				{
-					planeBits &= ~8;            // all descendants will also be in front
+					planeBits &= ~16;           // all descendants will also be in front
 				}
 			}
 
@@ -780,7 +780,8 @@ static void R_MarkLeaves(void)
 
 	vis = R_ClusterPVS(tr.viewCluster);
 
-	for (i = 0, leaf = tr.world->nodes ; i < tr.world->numnodes ; i++, leaf++)
+	// only the leafs carry a cluster, they are stored after the decision nodes
+	for (i = tr.world->numDecisionNodes, leaf = tr.world->nodes + i ; i < tr.world->numnodes ; i++, leaf++)
 	{
 		cluster = leaf->cluster;
 		if (cluster < 0 || cluster >= tr.world->numClusters)
@@ -264,6 +264,7 @@ typedef struct client_s
 	int lastValidGamestate;                 ///< svs.time when active in game
 	int lastSnapshotTime;                   ///< svs.time of last sent snapshot
 	qboolean rateDelayed;                   ///< true if lastSnapshotTime was set based on rate instead of snapshotMsec
+	int fragmentDelayed;                    ///< snapshots held back because fragments or queued messages were still pending
 	int timeoutCount;                       ///< must timeout a few frames in a row so debugging doesn't break
 	clientSnapshot_t frames[PACKET_BACKUP]; ///< updates can be delta'd from here
 	int ping;
@@ -304,6 +305,19 @@ typedef struct client_s
 
 #define STATFRAMES 100 ///< 5 seconds - assumed we run 20 fps
 
+/**
+ * @enum svFrameStage_t
+ * @brief Parts of the server frame timed for the framestats command
+ */
+typedef enum
+{
+	SV_STAGE_PACKETS,       ///< client packets, netchan processing and usercmd execution
+	SV_STAGE_GAME,          ///< game frames and demo recording / playback
+	SV_STAGE_SNAPSHOTS,     ///< building and sending client snapshots
+	SV_STAGE_MASTER,        ///< master server heartbeats and tracker
+	SV_STAGE_MAX
+} svFrameStage_t;
+
 /**
  * @struct svstats_t
  * @brief
@@ -319,6 +333,9 @@ typedef struct
 
 	float cpu;
 	float avg;
+
+	int64_t stageTime[SV_STAGE_MAX];            ///< usec spent in each frame stage during this window
+	int64_t latched_stageTime[SV_STAGE_MAX];
 } svstats_t;
 
 /**
@@ -528,11 +545,9 @@ void SV_CheckClientUserinfoTimer(void);
 void SV_SendClientIdle(client_t *client);
 void SV_SnapshotSetClientMask(int clientNum, uint64_t mask);
 
-#ifdef ETLEGACY_DEBUG
 void SV_PrintNetworkOverhead_f(void);
 void SV_ClearNetworkOverhead_f(void);
 void SV_InitNetworkOverhead(void);
-#endif
 
 // sv_game.c
 int SV_NumForGentity(sharedEntity_t *ent);
@@ -587,6 +602,9 @@ void SV_LinkEntity(sharedEntity_t *gEnt);
 clipHandle_t SV_ClipHandleForEntity(const sharedEntity_t *ent);
 
 void SV_SectorList_f(void);
+#ifdef ETLEGACY_DEBUG
+void SV_TraceBenchmark_f(void);
+#endif
 
 int SV_AreaEntities(const vec3_t mins, const vec3_t maxs, int *entityList, int maxcount);
 // fills in a table of entity numbers with entities that have bounding boxes
@@ -554,6 +554,74 @@ static void SV_Status_f(void)
 	Com_Printf("\n");
 }
 
+/**
+ * @brief Prints the average time per server frame spent in each frame stage
+ */
+static void SV_FrameStats_f(void)
+{
+	static const char *stageNames[SV_STAGE_MAX] = { "packets", "game", "snapshots", "master" };
+	int               i;
+
+	// make sure server is running
+	if (!com_sv_running->integer)
+	{
+		Com_Printf("Server is not running.\n");
+		return;
+	}
+
+	Com_Printf("average time per frame over the last %i server frames\n", STATFRAMES);
+	for (i = 0; i < SV_STAGE_MAX; i++)
+	{
+		Com_Printf("%-10s: %7.1f usec\n", stageNames[i], svs.stats.latched_stageTime[i] / (double)STATFRAMES);
+	}
+	// packets are handled by the event loop, outside of the server frame
+	Com_Printf("%-10s: %7.1f usec (without packets)\n", "frame", 1000000.0 * svs.stats.latched_active / STATFRAMES);
+}
+
+/**
+ * @brief Prints the outgoing netchan backlog of each client
+ */
+static void SV_NetQueue_f(void)
+{
+	int              i, queued;
+	client_t         *cl;
+	netchan_buffer_t *netbuf;
+	unsigned int     maxNameLength;
+
+	// make sure server is running
+	if (!com_sv_running->integer)
+	{
+		Com_Printf("Server is not running.\n");
+		return;
+	}
+
+	Com_Printf("num name                                unsent queued delayed\n");
+	Com_Printf("--- ----------------------------------- ------ ------ -------\n");
+
+	for (i = 0, cl = svs.clients ; i < sv_maxclients->integer ; i++, cl++)
+	{
+		if (!cl->state || cl->demoClient || (cl->gentity && (cl->gentity->r.svFlags & SVF_BOT)))
+		{
+			continue;
+		}
+
+		queued = 0;
+		for (netbuf = cl->netchan_start_queue; netbuf; netbuf = netbuf->next)
+		{
+			queued++;
+		}
+
+		// color codes take no space on the console, pad for them too
+		maxNameLength = sizeof(cl->name) + (strlen(cl->name) - Q_PrintStrlen(cl->name)) + 1;
+
+		Com_Printf("%3i %-*s %6i %6i %7i\n", i, maxNameLength, rc(cl->name),
+		           cl->netchan.unsentFragments ? cl->netchan.unsentLength - cl->netchan.unsentFragmentStart : 0,
+		           queued, cl->fragmentDelayed);
+	}
+
+	Com_Printf("\n");
+}
+
 /**
  * @brief SV_ConSay_f
  */
@@ -739,6 +807,8 @@ void SV_AddOperatorCommands(void)
 
 	Cmd_AddCommand("heartbeat", SV_Heartbeat_f, "Sends an heartbeat to master server.");
 	Cmd_AddCommand("status", SV_Status_f, "Prints server status info.");
+	Cmd_AddCommand("framestats", SV_FrameStats_f, "Prints the average time spent per server frame stage.");
+	Cmd_AddCommand("netqueue", SV_NetQueue_f, "Prints pending fragments, queued messages and delayed snapshots per client.");
 	Cmd_AddCommand("serverinfo", SV_Serverinfo_f, "Prints an info of server settings.");
 	Cmd_AddCommand("systeminfo", SV_Systeminfo_f, "Prints an info of game settings. ");
 	Cmd_AddCommand("dumpuser", SV_DumpUser_f, "Dumps user info to disk.");
@@ -753,9 +823,10 @@ void SV_AddOperatorCommands(void)
 
 	Cmd_AddCommand("tv", SV_CL_Commands_f, "tv commands.");
 
-#ifdef ETLEGACY_DEBUG
 	Cmd_AddCommand("net_overhead_print", SV_PrintNetworkOverhead_f, "Prints network overhead stats.");
 	Cmd_AddCommand("net_overhead_clear", SV_ClearNetworkOverhead_f, "Clears network overhead stats.");
+#ifdef ETLEGACY_DEBUG
+	Cmd_AddCommand("tracebench", SV_TraceBenchmark_f, "Times a fixed set of world traces.");
 #endif
 
 	if (com_dedicated->integer)
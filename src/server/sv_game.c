@@ -51,6 +51,7 @@ static ext_trap_keys_t g_extensionTraps[] =
 	{ "trap_SnapshotCallbackExt_Legacy",   G_SNAPSHOT_CALLBACK_EXT,  qfalse },
 	{ "trap_SnapshotSetClientMask_Legacy", G_SNAPSHOT_SETCLIENTMASK, qfalse },
 	{ "trap_CvarSetDescription_Legacy",    G_CVAR_SET_DESCRIPTION,   qfalse },
+	{ "trap_CvarGetModified_Legacy",       G_CVAR_GET_MODIFIED,      qfalse },
 	{ NULL,                                -1,                       qfalse }
 };
 
@@ -720,6 +721,9 @@ intptr_t SV_GameSystemCalls(intptr_t *args)
 	case G_CVAR_SET_DESCRIPTION:
 		return Cvar_SetDescriptionByName(VMA(1), VMA(2));
 
+	case G_CVAR_GET_MODIFIED:
+		return Cvar_JournalRead(CVAR_JOURNAL_GAME, VMA(1), args[2]);
+
 	default:
 		Com_Error(ERR_DROP, "Bad game system trap: %ld", (long int) args[0]);
 		break;
@@ -783,6 +787,9 @@ static void SV_InitGameVM(qboolean restart)
 	// mark all extensions as inactive
 	VM_Ext_ResetActive();
 
+	// the game registers all its cvars on init, older modifications are of no interest
+	Cvar_JournalReset(CVAR_JOURNAL_GAME);
+
 	// use the current msec count for a random seed
 	// init for this gamestate
 	VM_Call(gvm, GAME_INIT, sv.time, Com_Milliseconds(), restart, qtrue, ETLEGACY_VERSION_INT);
@@ -113,17 +113,50 @@ void SV_SetConfigstring(int index, const char *val)
 
 #define NEXT_WARNING_TIME 5000
 
+/**
+ * @brief Queue an already formatted configstring command for all relevant clients
+ * @param[in] index
+ * @param[in] message
+ */
+static void SV_SendConfigstringCommand(int index, const char *message)
+{
+	client_t *client;
+	int      i;
+
+	// see SV_SendServerCommand
+	if (strlen(message) > 1022)
+	{
+		SV_WriteAttackLog("Warning: q3infoboom/q3msgboom exploit attack.\n");
+		return;
+	}
+
+	for (i = 0, client = svs.clients; i < sv_maxclients->integer ; i++, client++)
+	{
+		if (client->state < CS_PRIMED || client->demoClient)
+		{
+			continue;
+		}
+		// do not always send server info to all clients
+		if (index == CS_SERVERINFO && client->gentity && (client->gentity->r.svFlags & SVF_NOSERVERINFO))
+		{
+			continue;
+		}
+
+		SV_AddServerCommand(client, message);
+	}
+}
+
 /**
  * @brief Updates the configstring
  * @note It's nice to know this function sends several server commands when a configstring is greater than 1000 usually BIG_INFO_STRINGs
  */
 void SV_UpdateConfigStrings(void)
 {
-	client_t   *client;
-	int        len, i, index, sent, remaining, cstotal = 0;
+	int        len, index, sent, remaining, cstotal = 0;
 	int        maxChunkSize = MAX_STRING_CHARS - 24;
 	const char *cmd;
 	char       buf[MAX_STRING_CHARS];
+	char       message[MAX_STRING_CHARS + 32];
 	static int nextWarningSysInfoTime   = 0;
 	static int nextWarningGameStateTime = 0;
 
@@ -161,54 +194,43 @@ void SV_UpdateConfigStrings(void)
 		// spawning a new server
 		if (sv.state == SS_GAME || sv.restarting)
 		{
-			// send the data to all relevent clients
-			for (i = 0, client = svs.clients; i < sv_maxclients->integer ; i++, client++)
+			// the command text is the same for every client, format it once
+			len = strlen(sv.configstrings[index]);
+			if (len >= maxChunkSize)
 			{
-				if (client->state < CS_PRIMED)
-				{
-					continue;
-				}
-				// do not always send server info to all clients
-				if (index == CS_SERVERINFO && client->gentity && (client->gentity->r.svFlags & SVF_NOSERVERINFO))
-				{
-					continue;
-				}
+				sent      = 0;
+				remaining = len;
 
-				len = strlen(sv.configstrings[index]);
-				if (len >= maxChunkSize)
+				while (remaining > 0)
 				{
-					sent      = 0;
-					remaining = len;
-
-					while (remaining > 0)
+					if (sent == 0)
 					{
-						if (sent == 0)
-						{
-							cmd = "bcs0";
-						}
-						else if (remaining < maxChunkSize)
-						{
-							cmd = "bcs2";
-						}
-						else
-						{
-							cmd = "bcs1";
-						}
-
-						Q_strncpyz(buf, &sv.configstrings[index][sent], maxChunkSize);
-
-						SV_SendServerCommand(client, "%s %i \"%s\"\n", cmd, index, buf);
-
-						sent      += (maxChunkSize - 1);
-						remaining -= (maxChunkSize - 1);
+						cmd = "bcs0";
 					}
-				}
-				else
-				{
-					// standard cs, just send it
-					SV_SendServerCommand(client, "cs %i \"%s\"\n", index, sv.configstrings[index]);
+					else if (remaining < maxChunkSize)
+					{
+						cmd = "bcs2";
+					}
+					else
+					{
+						cmd = "bcs1";
+					}
+
+					Q_strncpyz(buf, &sv.configstrings[index][sent], maxChunkSize);
+
+					Com_sprintf(message, sizeof(message), "%s %i \"%s\"\n", cmd, index, buf);
+					SV_SendConfigstringCommand(index, message);
+
+					sent      += (maxChunkSize - 1);
+					remaining -= (maxChunkSize - 1);
 				}
 			}
+			else
+			{
+				// standard cs, just send it
+				Com_sprintf(message, sizeof(message), "cs %i \"%s\"\n", index, sv.configstrings[index]);
+				SV_SendConfigstringCommand(index, message);
+			}
 		}
 
 		if (nextWarningGameStateTime <= svs.time)
@@ -1247,9 +1269,7 @@ void SV_Init(void)
 	IRC_Init();
 #endif
 
-#ifdef ETLEGACY_DEBUG
 	SV_InitNetworkOverhead();
-#endif
 }
 
 /**
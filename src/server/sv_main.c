@@ -91,6 +91,84 @@ static char *SV_ExpandNewlines(char *in)
 	return string;
 }
 
+#define TEAMINFOARGS 7 // clientNum location[3] health powerups ping
+
+/**
+ * @brief Mark the clients listed in a team info command
+ * @param[in] cmd
+ * @param[out] clients
+ * @return qfalse if the command can't be parsed
+ */
+static qboolean SV_TeamInfoClients(const char *cmd, byte *clients)
+{
+	int count, clientNum, i, j;
+
+	Com_Memset(clients, 0, MAX_CLIENTS);
+
+	// skip "tinfo "
+	cmd  += 6;
+	count = Q_atoi(cmd);
+
+	for (i = 0; i < count; i++)
+	{
+		for (j = 0; j < TEAMINFOARGS; j++)
+		{
+			cmd = strchr(cmd, ' ');
+			if (!cmd)
+			{
+				return qfalse;
+			}
+			cmd++;
+
+			if (j == 0)
+			{
+				clientNum = Q_atoi(cmd);
+				if (clientNum < 0 || clientNum >= MAX_CLIENTS)
+				{
+					return qfalse;
+				}
+				clients[clientNum] = 1;
+			}
+		}
+	}
+
+	return qtrue;
+}
+
+/**
+ * @brief Check if a queued command is fully replaced by a newer one
+ *
+ * Only team info qualifies, the client overwrites the state of every listed
+ * player with it. The newer update has to list exactly the same players, a
+ * player who just switched teams would otherwise let the info of one team
+ * replace the unsent info of the other.
+ *
+ * @param[in] pending
+ * @param[in] cmd
+ * @return
+ */
+static qboolean SV_ServerCommandSupersedes(const char *pending, const char *cmd)
+{
+	byte pendingClients[MAX_CLIENTS], cmdClients[MAX_CLIENTS];
+
+	if (Q_strncmp(cmd, "tinfo ", 6) || Q_strncmp(pending, "tinfo ", 6))
+	{
+		return qfalse;
+	}
+
+	if (!strcmp(pending, cmd))
+	{
+		return qtrue;
+	}
+
+	if (!SV_TeamInfoClients(pending, pendingClients) || !SV_TeamInfoClients(cmd, cmdClients))
+	{
+		return qfalse;
+	}
+
+	return !memcmp(pendingClients, cmdClients, sizeof(pendingClients));
+}
+
 /**
  * @brief The given command will be transmitted to the client, and is guaranteed
  * to not have future snapshot_t executed before it is executed
@@ -102,6 +180,18 @@ void SV_AddServerCommand(client_t *client, const char *cmd)
 {
 	int index;
 
+	// the latest command hasn't been transmitted yet and the new one replaces it,
+	// reuse its slot instead of growing the reliable window
+	if (client->reliableSequence > client->reliableSent && client->reliableSequence > client->reliableAcknowledge)
+	{
+		index = client->reliableSequence & (MAX_RELIABLE_COMMANDS - 1);
+		if (SV_ServerCommandSupersedes(client->reliableCommands[index], cmd))
+		{
+			Q_strncpyz(client->reliableCommands[index], cmd, sizeof(client->reliableCommands[index]));
+			return;
+		}
+	}
+
 	client->reliableSequence++;
 	// if we would be losing an old command that hasn't been acknowledged,
 	// we must drop the connection
@@ -1217,6 +1307,7 @@ void SV_PacketEvent(const netadr_t *from, msg_t *msg)
 	int      i;
 	client_t *cl;
 	int      qport;
+	int64_t  start;
 
 #ifdef DEDICATED
 	if (NET_CompareAdr(from, &svclc.serverAddress))
@@ -1271,6 +1362,8 @@ void SV_PacketEvent(const netadr_t *from, msg_t *msg)
 			cl->netchan.remoteAddress.port = from->port;
 		}
 
+		start = Sys_Microseconds();
+
 		// make sure it is a valid, in sequence packet
 		if (SV_Netchan_Process(cl, msg))
 		{
@@ -1284,6 +1377,7 @@ void SV_PacketEvent(const netadr_t *from, msg_t *msg)
 			}
 		}
 
+		svs.stats.stageTime[SV_STAGE_PACKETS] += Sys_Microseconds() - start;
 		return;
 	}
 }
@@ -1528,7 +1622,8 @@ int64_t SV_FrameMsec()
  */
 static void SV_Frame_Ext(int frameMsec)
 {
-	int startTime;
+	int     startTime;
+	int64_t stageStart;
 
 	if (cvar_modifiedFlags & CVAR_SERVERINFO)
 	{
@@ -1569,6 +1664,8 @@ static void SV_Frame_Ext(int frameMsec)
 	// update ping based on the all received frames
 	SV_CalcPings();
 
+	stageStart = Sys_Microseconds();
+
 	// run the game simulation in chunks
 	while (sv.timeResidual >= frameMsec)
 	{
@@ -1599,14 +1696,20 @@ static void SV_Frame_Ext(int frameMsec)
 		time_game = Sys_Milliseconds() - startTime;
 	}
 
+	svs.stats.stageTime[SV_STAGE_GAME] += Sys_Microseconds() - stageStart;
+
 	// check timeouts
 	SV_CheckTimeouts();
 
 	// check user info buffer thingy
 	SV_CheckClientUserinfoTimer();
 
+	stageStart = Sys_Microseconds();
+
 	// send messages back to the clients
 	SV_SendClientMessages();
+
+	svs.stats.stageTime[SV_STAGE_SNAPSHOTS] += Sys_Microseconds() - stageStart;
 }
 
 #ifdef DEDICATED
@@ -1628,6 +1731,7 @@ void SV_Frame(int msec)
 	char       mapname[MAX_QPATH];
 	int        frameStartTime = 0;
 	static int start, end;
+	int64_t    stageStart;
 
 	start           = Sys_Milliseconds();
 	svs.stats.idle += ( double )(start - end) / 1000;
@@ -1728,6 +1832,8 @@ void SV_Frame(int msec)
 		SV_Frame_Ext(frameMsec);
 	}
 
+	stageStart = Sys_Microseconds();
+
 	// send a heartbeat to the master if needed
 	SV_MasterHeartbeat(HEARTBEAT_GAME);
 
@@ -1735,6 +1841,8 @@ void SV_Frame(int msec)
 	Tracker_Frame(msec);
 #endif
 
+	svs.stats.stageTime[SV_STAGE_MASTER] += Sys_Microseconds() - stageStart;
+
 	if (com_dedicated->integer)
 	{
 		int frameEndTime = Sys_Milliseconds();
@@ -1800,6 +1908,9 @@ void SV_Frame(int msec)
 		svs.stats.idle           = 0;
 		svs.stats.count          = 0;
 
+		Com_Memcpy(svs.stats.latched_stageTime, svs.stats.stageTime, sizeof(svs.stats.stageTime));
+		Com_Memset(svs.stats.stageTime, 0, sizeof(svs.stats.stageTime));
+
 		svs.stats.cpu = svs.stats.latched_active + svs.stats.latched_idle;
 
 		if (svs.stats.cpu != 0.f)
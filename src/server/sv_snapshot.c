@@ -56,10 +56,9 @@ A normal server packet will look like:
 =============================================================================
 */
 
-#ifdef ETLEGACY_DEBUG
-
-// debugging code to evaluate network overhead
+// code to evaluate network overhead
 // taken from cnq3 - thanks myT
+// server commands are tracked in every build, entities only in debug builds
 
 typedef struct netSliceOverhead_s
 {
@@ -80,6 +79,7 @@ typedef struct netOverhead_s
 
 static netOverhead_t net_overhead;
 
+#ifdef ETLEGACY_DEBUG
 /**
  * @brief SV_TrackEntityOverhead
  * @param[in] offset
@@ -102,6 +102,7 @@ static void SV_TrackEntityOverhead(int offset, const msg_t *msg, const entitySta
 		}
 	}
 }
+#endif
 
 /**
  * @brief SV_TrackCommandOverhead
@@ -126,8 +127,6 @@ static void SV_TrackCommandOverhead(const int offset, const msg_t *msg, const ch
 	}
 }
 
-#endif
-
 /**
  * @brief Writes a delta update of an entityState_t list to the message.
  * @param[in] from
@@ -459,15 +458,12 @@ void SV_UpdateServerCommandsToClient(client_t *client, msg_t *msg)
 	// write any unacknowledged serverCommands
 	for (i = client->reliableAcknowledge + 1 ; i <= client->reliableSequence ; i++)
 	{
-#ifdef ETLEGACY_DEBUG
 		const int offset = msg->bit;
-#endif
+
 		MSG_WriteByte(msg, svc_serverCommand);
 		MSG_WriteLong(msg, i);
 		MSG_WriteString(msg, client->reliableCommands[i & (MAX_RELIABLE_COMMANDS - 1)]);
-#ifdef ETLEGACY_DEBUG
 		SV_TrackCommandOverhead(offset, msg, client->reliableCommands[i & (MAX_RELIABLE_COMMANDS - 1)]);
-#endif
 	}
 
 	client->reliableSent = client->reliableSequence;
@@ -1090,13 +1086,11 @@ void SV_SendMessageToClient(msg_t *msg, client_t *client, qboolean parseEntities
 
 	// send the datagram
 	SV_Netchan_Transmit(client, msg);
-#ifdef ETLEGACY_DEBUG
 	if (net_overhead.numSlices)
 	{
 		net_overhead.numBytesSent += msg->cursize;
 		net_overhead.numSent++;
 	}
-#endif
 }
 
 /**
@@ -1264,6 +1258,7 @@ void SV_SendClientMessages(void)
 		if (c->netchan.unsentFragments || c->netchan_start_queue)
 		{
 			c->rateDelayed = qtrue;
+			c->fragmentDelayed++;
 			continue;       // Drop this snapshot if the packet queue is still full or delta compression will break
 		}
 
@@ -1389,8 +1384,6 @@ void SV_SnapshotSetClientMask(int clientNum, uint64_t mask)
 	svs.clients[clientNum].clientMask = mask;
 }
 
-#ifdef ETLEGACY_DEBUG
-
 /**
  * @brief SV_PrintNetworkOverhead_f
  */
@@ -1460,11 +1453,57 @@ void SV_ClearNetworkOverhead_f(void)
 	}
 }
 
+/**
+ * @brief Check if the first token of a server command is one of the given names
+ * @param[in] cmd
+ * @param[in] names NULL terminated list
+ * @return
+ */
+static qboolean SV_OverheadCommandIs(const char *cmd, const char **names)
+{
+	size_t len = strcspn(cmd, " ");
+
+	for ( ; *names; names++)
+	{
+		if (strlen(*names) == len && !Q_stricmpn(cmd, *names, len))
+		{
+			return qtrue;
+		}
+	}
+
+	return qfalse;
+}
+
 static qboolean SV_OverheadIsTeamInfoCommand(const char *cmd)
 {
-	return !Q_stricmpn(cmd, "tinfo", 5);
+	static const char *names[] = { "tinfo", NULL };
+
+	return SV_OverheadCommandIs(cmd, names);
+}
+
+static qboolean SV_OverheadIsConfigstringCommand(const char *cmd)
+{
+	static const char *names[] = { "cs", "bcs0", "bcs1", "bcs2", NULL };
+
+	return SV_OverheadCommandIs(cmd, names);
+}
+
+static qboolean SV_OverheadIsScoreCommand(const char *cmd)
+{
+	static const char *names[] = { "sc0", "sc1", "sc", NULL };
+
+	return SV_OverheadCommandIs(cmd, names);
+}
+
+static qboolean SV_OverheadIsPrintCommand(const char *cmd)
+{
+	static const char *names[] = { "print", "cp", "cpm", "bp", "chat", "tchat", "vchat", "vtchat", "vbchat", "gamechat", "vschat", NULL };
+
+	return SV_OverheadCommandIs(cmd, names);
 }
 
+#ifdef ETLEGACY_DEBUG
+
 static qboolean SV_OverheadIsEBSShoutcastEntity(const entityState_t *ent)
 {
 	return ent->eType == ET_EBS_SHOUTCAST;
@@ -1479,6 +1518,7 @@ static qboolean SV_OverheadIsPlayerEntity(const entityState_t *ent)
 {
 	return ent->eType == ET_PLAYER;
 }
+#endif
 
 /**
  * @brief SV_InitNetworkOverhead
@@ -1488,15 +1528,25 @@ void SV_InitNetworkOverhead(void)
 	net_overhead.slices[0].name             = "Team Info";
 	net_overhead.slices[0].processCommand_f = &SV_OverheadIsTeamInfoCommand;
 
-	net_overhead.slices[1].name            = "ET_EBS_SHOUTCAST";
-	net_overhead.slices[1].processEntity_f = &SV_OverheadIsEBSShoutcastEntity;
+	net_overhead.slices[1].name             = "Configstrings";
+	net_overhead.slices[1].processCommand_f = &SV_OverheadIsConfigstringCommand;
 
-	net_overhead.slices[2].name            = "ET_EBS_FIRETEAM";
-	net_overhead.slices[2].processEntity_f = &SV_OverheadIsEBSFireteamEntity;
+	net_overhead.slices[2].name             = "Scores";
+	net_overhead.slices[2].processCommand_f = &SV_OverheadIsScoreCommand;
 
-	net_overhead.slices[3].name            = "ET_PLAYER";
-	net_overhead.slices[3].processEntity_f = &SV_OverheadIsPlayerEntity;
-	net_overhead.numSlices                 = 0;
-}
+	net_overhead.slices[3].name             = "Prints";
+	net_overhead.slices[3].processCommand_f = &SV_OverheadIsPrintCommand;
+	net_overhead.numSlices                  = 4;
+
+#ifdef ETLEGACY_DEBUG
+	net_overhead.slices[4].name            = "ET_EBS_SHOUTCAST";
+	net_overhead.slices[4].processEntity_f = &SV_OverheadIsEBSShoutcastEntity;
+
+	net_overhead.slices[5].name            = "ET_EBS_FIRETEAM";
+	net_overhead.slices[5].processEntity_f = &SV_OverheadIsEBSFireteamEntity;
 
+	net_overhead.slices[6].name            = "ET_PLAYER";
+	net_overhead.slices[6].processEntity_f = &SV_OverheadIsPlayerEntity;
+	net_overhead.numSlices                 = 7;
 #endif
+}
@@ -109,6 +109,96 @@ void SV_SectorList_f(void)
 	}
 }
 
+#ifdef ETLEGACY_DEBUG
+/**
+ * @brief Replays a fixed set of world traces and prints timings
+ *
+ * The traces are generated from a fixed seed inside the world bounds, so
+ * the checksum of the results must stay the same for a map between builds.
+ * Usage: tracebench [count]
+ */
+void SV_TraceBenchmark_f(void)
+{
+	static const int     bucketLimits[] = { 1, 2, 5, 10, 20, 50, 100 };
+	static const vec3_t  playerMins     = { -18, -18, -24 };
+	static const vec3_t  playerMaxs     = { 18, 18, 48 };
+	int                  buckets[ARRAY_LEN(bucketLimits) + 1];
+	int                  seed     = 0x1234567;
+	unsigned int         checksum = 0;
+	vec3_t               worldMins, worldMaxs, start, end;
+	trace_t              tr;
+	int64_t              total = 0, t, usec;
+	int                  count, i, j, brushTraces, patchTraces, endBrushTraces, endPatchTraces;
+
+	if (!com_sv_running->integer)
+	{
+		Com_Printf("Server is not running.\n");
+		return;
+	}
+
+	count = Cmd_Argc() > 1 ? Q_atoi(Cmd_Argv(1)) : 100000;
+	count = MAX(1, count);
+
+	Com_Memset(buckets, 0, sizeof(buckets));
+	CM_ModelBounds(0, worldMins, worldMaxs);
+
+	CM_TraceCounts(&brushTraces, &patchTraces);
+
+	for (i = 0; i < count; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			start[j] = worldMins[j] + Q_RandomFloat(&seed) * (worldMaxs[j] - worldMins[j]);
+			end[j]   = start[j] + (Q_RandomFloat(&seed) - 0.5f) * 1024.f;
+		}
+
+		// alternate between player box and point traces, like pmove and weapon fire
+		t = Sys_Microseconds();
+		if (i & 1)
+		{
+			CM_BoxTrace(&tr, start, end, vec3_origin, vec3_origin, 0, MASK_SHOT, qfalse);
+		}
+		else
+		{
+			CM_BoxTrace(&tr, start, end, playerMins, playerMaxs, 0, MASK_PLAYERSOLID, qfalse);
+		}
+		usec   = Sys_Microseconds() - t;
+		total += usec;
+
+		for (j = 0; j < ARRAY_LEN(bucketLimits) && usec >= bucketLimits[j]; j++)
+		{
+		}
+		buckets[j]++;
+
+		checksum = checksum * 31 + (unsigned int)(tr.fraction * 65536.f);
+		checksum = checksum * 31 + (unsigned int)(int)tr.endpos[0];
+		checksum = checksum * 31 + (unsigned int)(int)tr.endpos[1];
+		checksum = checksum * 31 + (unsigned int)(int)tr.endpos[2];
+		checksum = checksum * 31 + (unsigned int)(tr.startsolid | (tr.allsolid << 1));
+		checksum = checksum * 31 + (unsigned int)tr.contents;
+	}
+
+	CM_TraceCounts(&endBrushTraces, &endPatchTraces);
+	brushTraces = endBrushTraces - brushTraces;
+	patchTraces = endPatchTraces - patchTraces;
+
+	Com_Printf("tracebench: %i traces, %.3f usec/trace, %.1f brush %.1f patch tests/trace, checksum %08x\n",
+	           count, total / (double)count, brushTraces / (double)count, patchTraces / (double)count, checksum);
+
+	for (j = 0; j < ARRAY_LEN(buckets); j++)
+	{
+		if (j < ARRAY_LEN(bucketLimits))
+		{
+			Com_Printf("  < %3i usec: %i\n", bucketLimits[j], buckets[j]);
+		}
+		else
+		{
+			Com_Printf(" >= %3i usec: %i\n", bucketLimits[j - 1], buckets[j]);
+		}
+	}
+}
+#endif
+
 /**
  * @brief Builds a uniformly subdivided tree for the given world size
  * @param[in] depth
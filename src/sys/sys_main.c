@@ -611,6 +611,8 @@ void Sys_Error(const char *error, ...)
 	Q_vsnprintf(string, sizeof(string), error, argptr);
 	va_end(argptr);
 
+	Com_FlushLogfile();
+
 #ifdef USE_WINDOWS_CONSOLE
 	Conbuf_AppendText(string);
 	Conbuf_AppendText("\n");
@@ -1232,10 +1234,13 @@ void Sys_SigHandler(int signal)
 	else
 	{
 		signalcaught = qtrue;
+		// flush first, shutting down may fault again
+		Com_FlushLogfile();
 #ifndef DEDICATED
 		CL_Shutdown();
 #endif
 		SV_Shutdown(va("Received signal %d", signal));
+		Com_FlushLogfile();
 	}
 
 	if (signal == SIGTERM || signal == SIGINT)
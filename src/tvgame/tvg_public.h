@@ -231,6 +231,7 @@ typedef enum
 	G_SNAPSHOT_CALLBACK_EXT,
 	G_SNAPSHOT_SETCLIENTMASK,
 	G_CVAR_SET_DESCRIPTION,
+	G_CVAR_GET_MODIFIED,
 } gameImport_t;
 
 
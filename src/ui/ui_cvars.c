@@ -334,6 +334,8 @@ void UI_RegisterCvars(void)
 	uiInfo.xhairColorAlt[3] = ui_cg_crosshairAlphaAlt.value;
 }
 
+static modifiedCvars_t uiCvarJournal;
+
 /**
  * @brief UI_UpdateCvars
  */
@@ -342,11 +344,13 @@ void UI_UpdateCvars(void)
 	size_t      i;
 	cvarTable_t *cv;
 
+	BG_FetchModifiedCvars(&uiCvarJournal);
+
 	for (i = 0, cv = cvarTable ; i < cvarTableSize ; i++, cv++)
 	{
 		if (cv->vmCvar)
 		{
-			trap_Cvar_Update(cv->vmCvar);
+			BG_UpdateCvar(&uiCvarJournal, cv->vmCvar);
 			if (cv->modificationCount != cv->vmCvar->modificationCount)
 			{
 				cv->modificationCount = cv->vmCvar->modificationCount;
@@ -371,8 +375,8 @@ void UI_UpdateCvars(void)
 		static int ui_customFont1_lastMod = 1;
 		static int ui_customFont2_lastMod = 1;
 
-		trap_Cvar_Update(&ui_customFont1);
-		trap_Cvar_Update(&ui_customFont2);
+		BG_UpdateCvar(&uiCvarJournal, &ui_customFont1);
+		BG_UpdateCvar(&uiCvarJournal, &ui_customFont2);
 
 		if (ui_customFont1.modificationCount != ui_customFont1_lastMod)
 		{
@@ -752,8 +752,10 @@ void trap_openURL(const char *url);
 void trap_GetHunkData(int *hunkused, int *hunkexpected);
 qboolean trap_GetValue(char *value, int valueSize, const char *key);
 void trap_Cvar_SetDescription(const char *cvarName, const char *description);
+int trap_Cvar_GetModified(int *handles, int maxHandles);
 extern int dll_com_trapGetValue;
 extern int dll_trap_CvarSetDescription;
+extern int dll_trap_CvarGetModified;
 
 // localization functions
 const char *UI_TranslateString(const char *string);
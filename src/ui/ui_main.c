@@ -39,6 +39,7 @@
 uiInfo_t uiInfo;
 int      dll_com_trapGetValue;
 int      dll_trap_CvarSetDescription;
+int      dll_trap_CvarGetModified;
 
 static const char *MonthAbbrev[] =
 {
@@ -121,6 +122,7 @@ static ID_INLINE void UI_SetupExtensions(void)
 	{
 		dll_com_trapGetValue = Q_atoi(value);
 		UI_SetupExtensionTrap(value, MAX_CVAR_VALUE_STRING, &dll_trap_CvarSetDescription, "trap_CvarSetDescription_Legacy");
+		UI_SetupExtensionTrap(value, MAX_CVAR_VALUE_STRING, &dll_trap_CvarGetModified, "trap_CvarGetModified_Legacy");
 	}
 }
 
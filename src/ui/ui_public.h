@@ -188,6 +188,7 @@ typedef enum
 	///< engine extensions padding
 	UI_TRAP_GETVALUE = COM_TRAP_GETVALUE,
 	UI_CVAR_SET_DESCRIPTION,
+	UI_CVAR_GET_MODIFIED,
 
 } uiImport_t;
 
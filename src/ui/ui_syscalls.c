@@ -1188,3 +1188,19 @@ void trap_Cvar_SetDescription(const char *cvarName, const char *description)
 		SystemCall(dll_trap_CvarSetDescription, cvarName, description);
 	}
 }
+
+/**
+ * @brief Extension for reading the handles of cvars modified since the previous call.
+ * @param[out] handles
+ * @param[in] maxHandles
+ * @return number of handles written, -1 if the engine has no cvar journal
+ */
+int trap_Cvar_GetModified(int *handles, int maxHandles)
+{
+	if (dll_trap_CvarGetModified)
+	{
+		return SystemCall(dll_trap_CvarGetModified, handles, maxHandles);
+	}
+
+	return -1;
+}